@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "core/AnimationStateTable.h"
 #include "core/Texture.h"
 
 
@@ -17,6 +18,7 @@ namespace bkengine
         friend class ElementUtils;
         friend class AnimationBuilder;
         friend class AnimationUtils;
+        friend class AnimationStateTable;
 
     public:
         virtual ~Animation() = default;
@@ -25,17 +27,33 @@ namespace bkengine
 
         std::string getName() const;
         uint32_t getFramesPerTexture() const;
+        double getFrameDuration() const;
+        uint32_t getCurrentFrame() const;
+
+        /**
+            Advances the animation by the given number of textures without rendering.
+        */
+        void skipFrames(uint32_t);
 
     protected:
         explicit Animation() = default;
 
         std::string name;
 
-        uint32_t framesPerTexture;
-        uint32_t frameCounter = 0;
+        /** microseconds each texture is shown, 0 stops the animation */
+        uint64_t frameDuration = 0;
+        /** microseconds elapsed since the current texture was shown */
+        uint64_t elapsedTime = 0;
 
     private:
-        void _onRender();
+        void _onRender(uint64_t delta);
+        void advance(uint64_t delta);
+
+        /** false if the subclass does not override onRender() */
+        bool renderHook = true;
+
+        AnimationStateTable *stateTable = nullptr;
+        uint32_t stateIndex = 0;
 
         uint32_t currentTextureIndex = 0;
         std::vector<std::shared_ptr<Texture>> textures;
@@ -0,0 +1,51 @@
+#ifndef BKENGINE_ANIMATION_STATE_TABLE_H
+#define BKENGINE_ANIMATION_STATE_TABLE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+namespace bkengine
+{
+    class Animation;
+    class Element;
+
+    /**
+        Playback state of the active animations of a scene, stored as contiguous arrays
+        so that all animations are advanced in a single pass per frame.
+        The table is rebuilt from the current animations of the elements whenever it is
+        marked dirty. markDirty() is thread-safe, everything else runs on the game loop thread.
+    */
+    class AnimationStateTable
+    {
+        friend class Animation;
+
+    public:
+        AnimationStateTable() = default;
+        ~AnimationStateTable();
+
+        AnimationStateTable(const AnimationStateTable &) = delete;
+        AnimationStateTable &operator=(const AnimationStateTable &) = delete;
+
+        void markDirty();
+        bool isDirty() const;
+
+        void rebuild(const std::vector<std::shared_ptr<Element>> &elements);
+        void step(uint64_t delta);
+        void clear();
+
+        size_t size() const;
+
+    private:
+        std::vector<std::shared_ptr<Animation>> animations;
+        std::vector<uint32_t> frameIndices;
+        std::vector<uint32_t> frameCounts;
+        std::vector<uint64_t> elapsedTimes;
+        std::vector<uint64_t> frameDurations;
+
+        std::atomic<bool> dirty{true};
+    };
+}
+
+#endif  // BKENGINE_ANIMATION_STATE_TABLE_H
@@ -0,0 +1,89 @@
+#ifndef BKENGINE_ASSET_LOADER_H
+#define BKENGINE_ASSET_LOADER_H
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "core/AsyncTexture.h"
+#include "utils/JobSystem.h"
+#include "utils/Logger.h"
+
+
+namespace bkengine
+{
+    /**
+        Loads textures in two steps. The load function runs on the workers of a job system as a
+        background job, so a thread waiting for the jobs of a frame never runs a load itself; only
+        finish() and cancel() help loading. It reads and decodes the asset and returns the upload
+        function, which creates the texture in applyLoaded(). The game calls applyLoaded() at the
+        beginning of every frame, so textures are only created on the game loop thread and never
+        change while a frame is updated or rendered.
+        Requests with a higher priority are loaded first. The load functions run concurrently and
+        have to be thread-safe, they must not create textures.
+        Neither function may own the game: the last reference could otherwise be dropped on a
+        worker, whose ~Game would wait for its own load. They refer to the game by a plain Game
+        pointer or reference instead, which stays valid because ~Game cancels the queued loads and
+        waits for the running ones.
+    */
+    class AssetLoader
+    {
+    public:
+        typedef std::function<std::shared_ptr<Texture>()> Upload;
+        typedef std::function<Upload()> Load;
+
+        explicit AssetLoader(const std::shared_ptr<JobSystem> &jobSystem);
+        ~AssetLoader();
+
+        AssetLoader(const AssetLoader &) = delete;
+        AssetLoader &operator=(const AssetLoader &) = delete;
+
+        void load(const std::shared_ptr<AsyncTexture> &texture, const Load &loader, int32_t priority = 0);
+
+        /** uploads the finished loads on the calling thread and swaps them in, returns how many were applied */
+        size_t applyLoaded();
+        /** blocks until every queued load is finished and applies them */
+        void finish();
+        /** drops every queued load and blocks until the running ones are finished */
+        void cancel();
+
+        /** number of loads which are queued, running or waiting to be applied */
+        size_t getPendingCount() const;
+
+    private:
+        struct Request
+        {
+            int32_t priority;
+            uint64_t sequence;
+            std::weak_ptr<AsyncTexture> texture;
+            Load loader;
+
+            bool operator<(const Request &request) const;
+        };
+
+        struct Result
+        {
+            std::shared_ptr<AsyncTexture> asyncTexture;
+            Upload upload;
+            std::string error;
+        };
+
+        void loadNext();
+
+        std::shared_ptr<JobSystem> jobSystem;
+        JobCounter counter;
+
+        mutable std::mutex mutex;
+        std::priority_queue<Request> requests;
+        std::vector<Result> results;
+        uint64_t nextSequence = 0;
+        size_t loading = 0;
+    };
+}
+
+#endif  // BKENGINE_ASSET_LOADER_H
@@ -0,0 +1,60 @@
+#ifndef BKENGINE_ASYNC_TEXTURE_H
+#define BKENGINE_ASYNC_TEXTURE_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "core/Texture.h"
+
+
+namespace bkengine
+{
+    enum class LoadState
+    {
+        PENDING,
+        LOADED,
+        FAILED,
+        CANCELLED
+    };
+
+    /**
+        Handle to a texture which is loaded by the AssetLoader of a game.
+        It renders its placeholder (if any) until the loaded texture is swapped in at the
+        beginning of a frame.
+    */
+    class AsyncTexture : public Texture
+    {
+        friend class AssetLoader;
+        friend class ImageTextureBuilder;
+        friend class TextTextureBuilder;
+
+    public:
+        void onRender() override;
+
+        LoadState getState() const;
+        bool isLoaded() const;
+        /** message of the exception which made the load fail */
+        std::string getError() const;
+
+        /**
+            Drops the load if it has not started yet, a running load is discarded when finished.
+        */
+        void cancel();
+
+        /** the loaded texture, otherwise the placeholder */
+        std::shared_ptr<Texture> getTexture() const;
+
+    protected:
+        explicit AsyncTexture() = default;
+
+    private:
+        std::atomic<LoadState> state{LoadState::PENDING};
+        std::string error;
+
+        std::shared_ptr<Texture> placeholder = nullptr;
+        std::shared_ptr<Texture> texture = nullptr;
+    };
+}
+
+#endif  // BKENGINE_ASYNC_TEXTURE_H
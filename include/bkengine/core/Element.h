@@ -6,8 +6,11 @@
 #include <vector>
 
 #include "core/Animation.h"
+#include "core/EventSubscription.h"
 #include "utils/Event.h"
 #include "utils/Geometry.h"
+#include "utils/JobSystem.h"
+#include "utils/MemoryResource.h"
 
 
 namespace bkengine
@@ -16,10 +19,12 @@ namespace bkengine
 
     class Element
     {
+        friend class AnimationStateTable;
         friend class Scene;
         friend class SceneUtils;
         friend class ElementBuilder;
         friend class ElementUtils;
+        friend class EventDispatcher;
 
     public:
         virtual ~Element() = default;
@@ -31,6 +36,9 @@ namespace bkengine
         std::string getName() const;
         RelRect getRenderBox() const;
         RelRect getCollisionBox() const;
+        std::shared_ptr<JobSystem> getJobSystem() const;
+        std::shared_ptr<MemoryResource> getMemoryResource() const;
+        bool isThreadSafe() const;
 
     protected:
         explicit Element() = default;
@@ -41,13 +49,17 @@ namespace bkengine
         Rect collisionBox;
 
     private:
-        void _onRender();
+        void _onRender(uint64_t delta);
         void _onLoop();
         void _onEvent(const Event &);
 
         std::weak_ptr<Scene> parentScene;
 
         uint32_t collisionLayer = 0;
+        bool threadSafe = false;
+
+        bool subscribedToAll = true;
+        std::vector<EventSubscription> subscriptions;
 
         std::shared_ptr<Animation> currentAnimation;
         std::vector<std::shared_ptr<Animation>> animations;
@@ -0,0 +1,90 @@
+#ifndef BKENGINE_EVENT_DISPATCHER_H
+#define BKENGINE_EVENT_DISPATCHER_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "core/EventSubscription.h"
+#include "utils/Event.h"
+#include "utils/Geometry.h"
+#include "utils/SpatialGrid.h"
+
+
+namespace bkengine
+{
+    class Element;
+
+    /**
+        Index of the event subscriptions of the elements of a scene, mapping every event to the
+        elements interested in it. Elements which did not subscribe to anything receive every event.
+        The index is rebuilt lazily once marked dirty. markDirty() is thread-safe, everything else
+        runs on the event thread.
+
+        For hit testing the render boxes are kept in a spatial grid, rebuilt with the first pointer
+        event after the geometry was invalidated.
+    */
+    class EventDispatcher
+    {
+    public:
+        void markDirty();
+        bool isDirty() const;
+
+        void rebuild(const std::vector<std::shared_ptr<Element>> &elements);
+
+        /** receivers of the event in scene order, valid until the next call */
+        const std::vector<Element *> &getReceivers(const Event &event);
+
+        /** marks the render boxes as moved */
+        void invalidateGeometry();
+        /**
+            Receivers of a pointer event whose render box contains the cursor, top-most (last rendered) first.
+        */
+        const std::vector<Element *> &getHitReceivers(const Event &event,
+                                                      const std::vector<std::shared_ptr<Element>> &elements,
+                                                      const Size &windowSize);
+
+        size_t getSubscriptionCount() const;
+        /** grid of the render boxes clipped to the window, as of the last hit test */
+        const SpatialGrid &getHitGrid() const;
+
+        static bool isPointerEvent(const Event &event);
+
+    private:
+        struct Entry
+        {
+            size_t order;
+            Element *element;
+            EventSubscription subscription;
+        };
+
+        static const size_t EVENT_TYPE_COUNT = static_cast<size_t>(EventType::WINDOW) + 1;
+
+        void collect(const std::vector<Entry> &entries, const Event &event);
+        void updateCursor(const Event &event);
+        bool isInterested(const Element &element, const Event &event) const;
+        void rebuildHitGrid(const std::vector<std::shared_ptr<Element>> &elements, const Size &windowSize);
+
+        std::vector<Entry> broadcast;
+        std::array<std::vector<Entry>, EVENT_TYPE_COUNT> typed;
+        std::unordered_map<uint16_t, std::vector<Entry>> keyed;
+        size_t subscriptionCount = 0;
+
+        // window coordinates of the last mouse or motion event, used for wheel events
+        Point cursor = {0, 0};
+        std::vector<const Entry *> candidates;
+        std::vector<Element *> receivers;
+
+        SpatialGrid hitGrid;
+        std::vector<AbsRect> hitBoxes;
+        Size hitGridWindowSize = {0, 0};
+        bool geometryStale = true;
+        std::vector<uint32_t> hitCandidates;
+
+        std::atomic<bool> dirty{true};
+    };
+}
+
+#endif  // BKENGINE_EVENT_DISPATCHER_H
@@ -0,0 +1,31 @@
+#ifndef BKENGINE_EVENT_SUBSCRIPTION_H
+#define BKENGINE_EVENT_SUBSCRIPTION_H
+
+#include "utils/Event.h"
+#include "utils/Geometry.h"
+#include "utils/Key.h"
+
+
+namespace bkengine
+{
+    /**
+        Events an element is interested in: every event of a type, keyboard events of a single
+        key or pointer events (MOUSE, MOTION, WHEEL) with the cursor inside a region of the window.
+    */
+    struct EventSubscription
+    {
+        EventType type = EventType::UNKNOWN;
+        bool filterKey = false;
+        Key key;
+        bool filterRegion = false;
+        AbsRect region = {0, 0, 0, 0};
+
+        static EventSubscription forType(EventType type);
+        static EventSubscription forKey(const Key &key);
+        static EventSubscription forRegion(EventType type, const AbsRect &region);
+
+        bool matches(const Event &event, const Point &cursor) const;
+    };
+}
+
+#endif  // BKENGINE_EVENT_SUBSCRIPTION_H
@@ -2,13 +2,25 @@
 #define BKENGINE_GAME_H
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "core/AssetLoader.h"
+#include "core/GlyphCache.h"
 #include "core/Scene.h"
+#include "core/TextLayoutCache.h"
+#include "core/TextureCache.h"
 #include "exceptions/GameLoopException.h"
+#include "utils/AssetArchive.h"
+#include "utils/EventCoalescer.h"
+#include "utils/EventLog.h"
+#include "utils/ImageDiskCache.h"
+#include "utils/InputState.h"
 #include "utils/InterfaceContainer.h"
+#include "utils/JobSystem.h"
 #include "utils/Logger.h"
+#include "utils/SpscQueue.h"
 #include "utils/Timer.h"
 
 
@@ -20,15 +32,33 @@ namespace bkengine
         friend class GameUtils;
         friend class ImageTextureBuilder;
         friend class TextTextureBuilder;
+        friend class TextureAtlasBuilder;
 
     public:
-        virtual ~Game() = default;
+        /** waits for the running loads of the asset loader, which refer to the game without owning it */
+        virtual ~Game();
 
         void run();
         void stop();
 
         bool isRunning() const;
 
+        std::shared_ptr<JobSystem> getJobSystem() const;
+        std::shared_ptr<AssetLoader> getAssetLoader() const;
+        /**
+            Milliseconds elapsed between the start of the previous and the current frame.
+        */
+        double getFrameDelta() const;
+        Size getWindowSize() const;
+        /**
+            Keyboard and mouse state including all events polled so far in the current frame.
+        */
+        const InputState &getInputState() const;
+        /** number of frames since run() was started */
+        uint64_t getFrameIndex() const;
+        bool isHeadless() const;
+        std::shared_ptr<EventRecorder> getEventRecorder() const;
+
     protected:
         explicit Game() = default;
 
@@ -44,11 +74,38 @@ namespace bkengine
         void _onRender();
         void _onLoop();
         void _onEvent(const Event &);
+        void receiveEvent(const Event &);
+        void processEvent(const Event &);
 
         InterfaceContainer interfaceContainer;
+        std::shared_ptr<JobSystem> jobSystem = nullptr;
+        std::shared_ptr<AssetLoader> assetLoader = nullptr;
+        TextureCache textureCache;
+        std::shared_ptr<ImageDiskCache> imageDiskCache = nullptr;
+        GlyphCache glyphCache;
+        TextLayoutCache textLayoutCache;
+
+        std::mutex archiveMutex;
+        std::vector<std::shared_ptr<AssetArchive>> archives;
 
         bool running = false;
         Timer timer;
+        uint64_t frameDelta = 0;
+        uint64_t frameIndex = 0;
+        // headless runs neither wait for the next frame nor measure the frame delta
+        bool headless = false;
+        // render every n-th frame, never if 0
+        uint32_t renderInterval = 1;
+        // stop after this many frames, never if 0
+        uint64_t maxFrames = 0;
+        Size windowSize = {0, 0};
+        InputState inputState;
+        // filled by the input thread, if enabled
+        std::unique_ptr<SpscQueue<Event>> eventQueue = nullptr;
+        std::vector<Event> eventBuffer;
+        EventCoalescer eventCoalescer;
+        // records every received event before coalescing, if set
+        std::shared_ptr<EventRecorder> eventRecorder = nullptr;
 
         std::shared_ptr<Scene> currentScene = nullptr;
         std::vector<std::shared_ptr<Scene>> scenes;
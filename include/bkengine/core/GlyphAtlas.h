@@ -0,0 +1,141 @@
+#ifndef BKENGINE_GLYPH_ATLAS_H
+#define BKENGINE_GLYPH_ATLAS_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/ImageTexture.h"
+#include "core/TextTexture.h"
+#include "utils/Geometry.h"
+#include "utils/RectPacker.h"
+
+
+namespace bkengine
+{
+    class FontInterface;
+
+    /**
+        Rasterized glyph with 8 bit coverage values, row by row without padding.
+        The offset places the top left corner of the bitmap relative to the pen position
+        at the top of the line, the advance moves the pen to the next glyph.
+    */
+    struct GlyphBitmap
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        int32_t offsetX = 0;
+        int32_t offsetY = 0;
+        int32_t advance = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    /** glyphs rasterized ahead of a layout, by codepoint */
+    typedef std::unordered_map<uint32_t, GlyphBitmap> GlyphBitmaps;
+
+    /** part of an atlas page drawn at the destination, relative to the top left of the text */
+    struct GlyphQuad
+    {
+        uint32_t page;
+        AbsRect source;
+        AbsRect destination;
+    };
+
+    /**
+        Text laid out as quads. For every glyph the byte offset of its first code unit, the pen
+        position, the index of its first quad and the height of the text before it are kept, so
+        that a layout can be continued after an unchanged prefix.
+    */
+    struct TextLayout
+    {
+        struct GlyphPosition
+        {
+            size_t offset;
+            double pen;
+            size_t quad;
+            double height;
+        };
+
+        std::string text;
+        double scale = 1;
+        std::vector<GlyphQuad> quads;
+        std::vector<GlyphPosition> glyphs;
+        double pen = 0;
+        Size bounds = {0, 0};
+    };
+
+    /**
+        Glyphs of one font, size and quality, each rasterized once on first use and packed
+        into atlas pages created by the font interface. Kerning is not applied.
+        Atlases of TextQuality::SDF keep distance fields rendered at SDF_SIZE, padded by SDF_SPREAD
+        pixels, and are shared by all sizes of the font. All methods are thread-safe.
+    */
+    class GlyphAtlas
+    {
+    public:
+        static const uint32_t PAGE_SIZE = 512;
+        static const uint32_t SDF_SIZE = 48;
+        static const uint32_t SDF_SPREAD = 6;
+        static const uint32_t FALLBACK_CODEPOINT = '?';
+
+        GlyphAtlas(const std::shared_ptr<FontInterface> &fontInterface,
+                   const std::string &fontName,
+                   double fontSize,
+                   TextQuality quality);
+
+        /**
+            Lays out UTF-8 encoded text as a single line, rasterizing missing glyphs.
+            The glyphs of the prefix shared with the previous text of the layout are kept.
+            Glyphs the font cannot render are drawn as FALLBACK_CODEPOINT.
+            The scale is applied to the glyph metrics, only distance fields should be scaled.
+            Returns false and leaves the layout unchanged if the font interface does not support
+            glyph rendering. Glyphs found in rasterized are packed without rendering them again.
+        */
+        bool layout(const std::string &text,
+                    TextLayout &layout,
+                    double scale = 1,
+                    const GlyphBitmaps *rasterized = nullptr);
+        /**
+            Rasterizes the glyphs of the text which are not in the atlas yet, including the fallback
+            if a glyph cannot be rendered, for a later layout. Only calls FontInterface::renderGlyph
+            and leaves the pages untouched, so it can run on a worker.
+        */
+        void rasterize(const std::string &text, GlyphBitmaps &bitmaps);
+
+        std::shared_ptr<ImageTexture> getPage(uint32_t index);
+        uint32_t getPageCount();
+        size_t getGlyphCount();
+
+        std::string getFontName() const;
+        double getFontSize() const;
+        TextQuality getQuality() const;
+
+    private:
+        struct Glyph
+        {
+            uint32_t page;
+            AbsRect source;
+            int32_t offsetX;
+            int32_t offsetY;
+            int32_t advance;
+        };
+
+        const Glyph *getGlyph(uint32_t codepoint, const GlyphBitmaps *rasterized);
+        bool renderGlyph(uint32_t codepoint, GlyphBitmap &bitmap) const;
+
+        std::shared_ptr<FontInterface> fontInterface;
+        std::string fontName;
+        double fontSize;
+        TextQuality quality;
+
+        std::mutex mutex;
+        std::unordered_map<uint32_t, Glyph> glyphs;
+        std::vector<std::shared_ptr<ImageTexture>> pages;
+        RectPacker packer;
+    };
+}
+
+#endif  // BKENGINE_GLYPH_ATLAS_H
@@ -0,0 +1,42 @@
+#ifndef BKENGINE_GLYPH_CACHE_H
+#define BKENGINE_GLYPH_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "core/GlyphAtlas.h"
+#include "core/TextTexture.h"
+
+
+namespace bkengine
+{
+    class FontInterface;
+
+    /**
+        Glyph atlases of a game, one per font, size and quality, distance field atlases are
+        shared by all sizes of a font. Atlases live as long as the cache
+        unless purged. All methods are thread-safe.
+    */
+    class GlyphCache
+    {
+    public:
+        std::shared_ptr<GlyphAtlas> getAtlas(const std::shared_ptr<FontInterface> &fontInterface,
+                                             const std::string &fontName,
+                                             double fontSize,
+                                             TextQuality quality);
+
+        size_t size();
+        void purge();
+
+    private:
+        typedef std::tuple<std::string, double, TextQuality> Key;
+
+        std::mutex mutex;
+        std::map<Key, std::shared_ptr<GlyphAtlas>> atlases;
+    };
+}
+
+#endif  // BKENGINE_GLYPH_CACHE_H
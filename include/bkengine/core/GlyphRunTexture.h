@@ -0,0 +1,46 @@
+#ifndef BKENGINE_GLYPH_RUN_TEXTURE_H
+#define BKENGINE_GLYPH_RUN_TEXTURE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/GlyphAtlas.h"
+#include "core/TextTexture.h"
+
+
+namespace bkengine
+{
+    /**
+        Text drawn as a run of quads from the pages of a glyph atlas.
+        The pages of TextQuality::SDF atlases hold distance fields, onRender has to alpha-test them.
+    */
+    class GlyphRunTexture : public TextTexture
+    {
+        friend class TextTextureBuilder;
+
+    public:
+        virtual void onRender() = 0;
+
+        /**
+            Replaces the text in place. The layout of the prefix shared with the previous text is
+            kept and only glyphs not yet in the atlas are rasterized.
+            Returns false and keeps the previous text if the atlas cannot lay it out.
+        */
+        bool setText(const std::string &);
+        std::string getText() const;
+
+        const std::vector<GlyphQuad> &getQuads() const;
+        /** size of the laid out text in pixels */
+        Size getTextSize() const;
+        std::shared_ptr<GlyphAtlas> getAtlas() const;
+
+    protected:
+        explicit GlyphRunTexture() = default;
+
+        std::shared_ptr<GlyphAtlas> atlas = nullptr;
+        TextLayout layout;
+    };
+}
+
+#endif  // BKENGINE_GLYPH_RUN_TEXTURE_H
@@ -1,6 +1,8 @@
 #ifndef BKENGINE_IMAGE_TEXTURE_H
 #define BKENGINE_IMAGE_TEXTURE_H
 
+#include <memory>
+
 #include "core/Texture.h"
 
 
@@ -9,14 +11,25 @@ namespace bkengine
     class ImageTexture : public Texture
     {
         friend class ImageTextureBuilder;
+        friend class TextureCache;
 
     public:
         virtual void onRender() = 0;
 
+        /**
+            Copy sharing the pixel data of this texture, nullptr if the interface does not support it.
+        */
+        virtual std::shared_ptr<ImageTexture> clone() const;
+
+        /** the texture whose pixel data is drawn (atlas page or cached image), nullptr if it owns its data */
+        std::shared_ptr<ImageTexture> getPage() const;
+        AbsRect getClip() const;
+
     protected:
         explicit ImageTexture() = default;
 
         Rect clip;
+        std::shared_ptr<ImageTexture> page = nullptr;
     };
 }
 
@@ -2,24 +2,32 @@
 #define BKENGINE_SCENE_H
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "core/AnimationStateTable.h"
 #include "core/Element.h"
+#include "core/EventDispatcher.h"
+#include "core/SceneCommandBuffer.h"
 #include "interfaces/GraphicsInterface.h"
 #include "utils/Event.h"
+#include "utils/JobSystem.h"
 #include "utils/Logger.h"
+#include "utils/MemoryResource.h"
 
 
 namespace bkengine
 {
     class Game;
 
-    class Scene
+    class Scene : public std::enable_shared_from_this<Scene>
     {
+        friend class ElementUtils;
         friend class Game;
         friend class GameUtils;
         friend class SceneBuilder;
@@ -33,20 +41,45 @@ namespace bkengine
         virtual bool onEvent(const Event &);
 
         std::string getName() const;
+        std::shared_ptr<JobSystem> getJobSystem() const;
+        /**
+            The arena of the scene until it handles its first event or update, nullptr afterwards
+            and for scenes without arena. Objects created while the scene runs are usually spawned
+            and despawned again and are taken from the object pools instead.
+        */
+        std::shared_ptr<MemoryResource> getMemoryResource() const;
+        Size getWindowSize() const;
 
     protected:
         explicit Scene() = default;
 
     private:
-        void _onLoop();
-        void _onRender();
+        void _onLoop(uint64_t delta);
+        void _onRender(uint64_t delta);
         void _onEvent(const Event &);
 
+        void updateConcurrently(const std::shared_ptr<JobSystem> &jobSystem);
+
         std::weak_ptr<Game> parentGame;
+        std::shared_ptr<MonotonicBufferResource> arena;
+        std::atomic<bool> running{false};
         std::string name;
 
         std::vector<std::shared_ptr<Element>> elements;
+        std::unordered_map<std::string, std::shared_ptr<Element>> elementIndex;
         std::map<uint32_t, std::vector<std::shared_ptr<Element>>> collisionLayers;
+
+        AnimationStateTable animationStates;
+        EventDispatcher eventDispatcher;
+        bool hitTesting = false;
+        std::weak_ptr<Element> pointerCapture;
+
+        bool parallelUpdate = false;
+        uint32_t updateGrainSize = 0;
+        std::vector<Element *> concurrentElements;
+
+        std::atomic<bool> deferringChanges{false};
+        SceneCommandBuffer commandBuffer;
     };
 }
 
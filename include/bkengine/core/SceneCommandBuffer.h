@@ -0,0 +1,84 @@
+#ifndef BKENGINE_SCENE_COMMAND_BUFFER_H
+#define BKENGINE_SCENE_COMMAND_BUFFER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace bkengine
+{
+    class Element;
+
+    enum class SceneCommandType
+    {
+        ADD_ELEMENT,
+        REMOVE_ELEMENT,
+        REMOVE_ALL_ELEMENTS,
+        MOVE_ELEMENT
+    };
+
+    struct SceneCommand
+    {
+        SceneCommandType type;
+        std::shared_ptr<Element> element;
+        std::string name;
+        uint32_t collisionLayer;
+    };
+
+    /**
+        Records structural changes of a scene while its elements are updated.
+        The buffer keeps track of the pending additions, removals and moves so that lookups,
+        element lists and collision layers see the scene as if the recorded commands were
+        already applied.
+        Every method takes the elements as they are currently stored in the scene (or nullptr)
+        and is thread-safe.
+    */
+    class SceneCommandBuffer
+    {
+    public:
+        bool addElement(const std::shared_ptr<Element> &element,
+                        const std::string &name,
+                        uint32_t collisionLayer,
+                        const std::shared_ptr<Element> &elementInScene);
+        std::shared_ptr<Element> removeElement(const std::string &name, const std::shared_ptr<Element> &elementInScene);
+        void removeAllElements();
+        bool moveElement(const std::string &name,
+                         uint32_t collisionLayer,
+                         const std::shared_ptr<Element> &elementInScene);
+
+        std::shared_ptr<Element> getElement(const std::string &name,
+                                            const std::shared_ptr<Element> &elementInScene) const;
+        std::vector<std::shared_ptr<Element>>
+        getElements(const std::vector<std::shared_ptr<Element>> &elementsInScene) const;
+        std::vector<std::shared_ptr<Element>>
+        getCollisionLayer(uint32_t collisionLayer,
+                          const std::vector<std::shared_ptr<Element>> &layerInScene,
+                          const std::vector<std::shared_ptr<Element>> &elementsInScene) const;
+        uint32_t getCollisionLayerIndex(const std::string &name, uint32_t collisionLayerInScene) const;
+
+        std::vector<SceneCommand> takeCommands();
+        bool empty() const;
+
+    private:
+        bool isRemoved(const std::string &name) const;
+        std::shared_ptr<Element> lookup(const std::string &name, const std::shared_ptr<Element> &elementInScene) const;
+        bool isVisible(const std::shared_ptr<Element> &elementInScene) const;
+        std::vector<std::shared_ptr<Element>> getAdditions() const;
+
+        mutable std::mutex mutex;
+        std::atomic<uint32_t> commandCount{0};
+        std::vector<SceneCommand> commands;
+
+        std::unordered_map<std::string, std::shared_ptr<Element>> pendingAdditions;
+        std::unordered_set<std::string> pendingRemovals;
+        std::unordered_map<std::string, uint32_t> pendingLayers;
+        bool allRemoved = false;
+    };
+}
+
+#endif  // BKENGINE_SCENE_COMMAND_BUFFER_H
@@ -0,0 +1,86 @@
+#ifndef BKENGINE_TEXT_LAYOUT_CACHE_H
+#define BKENGINE_TEXT_LAYOUT_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "core/GlyphAtlas.h"
+#include "core/TextTexture.h"
+
+
+namespace bkengine
+{
+    /**
+        Layouts of recently built texts, keyed by text, font, size and quality. The least recently
+        used layouts are dropped once the cache holds more than its capacity.
+        Layouts refer to the pages and packing of the atlas they were created with, so they are
+        only returned for that atlas, e.g. not after the glyph cache has been purged.
+        All methods are thread-safe.
+    */
+    class TextLayoutCache
+    {
+    public:
+        static const size_t DEFAULT_CAPACITY = 1024;
+
+        explicit TextLayoutCache(size_t capacity = DEFAULT_CAPACITY);
+
+        /** returns nullptr on a miss or if the layout was created with another atlas */
+        std::shared_ptr<const TextLayout> get(const std::string &text,
+                                              const std::string &fontName,
+                                              double fontSize,
+                                              TextQuality quality,
+                                              const std::shared_ptr<const GlyphAtlas> &atlas);
+        void put(const std::string &fontName,
+                 double fontSize,
+                 TextQuality quality,
+                 const std::shared_ptr<const GlyphAtlas> &atlas,
+                 const std::shared_ptr<const TextLayout> &layout);
+
+        void setCapacity(size_t capacity);
+        size_t getCapacity();
+        size_t size();
+        void purge();
+
+        uint64_t getHitCount() const;
+        uint64_t getMissCount() const;
+
+    private:
+        struct Key
+        {
+            std::string text;
+            std::string fontName;
+            double fontSize;
+            TextQuality quality;
+
+            bool operator==(const Key &key) const;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const;
+        };
+
+        struct Entry
+        {
+            std::shared_ptr<const TextLayout> layout;
+            std::weak_ptr<const GlyphAtlas> atlas;
+        };
+
+        typedef std::list<std::pair<Key, Entry>> EntryList;
+
+        void shrink();
+
+        std::mutex mutex;
+        size_t capacity;
+        EntryList entries;
+        std::unordered_map<Key, EntryList::iterator, KeyHash> index;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+    };
+}
+
+#endif  // BKENGINE_TEXT_LAYOUT_CACHE_H
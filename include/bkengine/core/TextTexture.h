@@ -9,7 +9,9 @@ namespace bkengine
     enum class TextQuality
     {
         SOLID = 1,
-        BLENDED = 2
+        BLENDED = 2,
+        /** glyphs are kept as distance fields and scaled to any size, interfaces without glyph support use BLENDED */
+        SDF = 3
     };
 
     class TextTexture : public Texture
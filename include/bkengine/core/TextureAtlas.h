@@ -0,0 +1,53 @@
+#ifndef BKENGINE_TEXTURE_ATLAS_H
+#define BKENGINE_TEXTURE_ATLAS_H
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/ImageTexture.h"
+#include "exceptions/NameNotFoundException.h"
+#include "utils/Geometry.h"
+
+
+namespace bkengine
+{
+    /**
+        An image packed into an atlas. source is the part of the image file that was packed,
+        destination its position on the page.
+    */
+    struct AtlasRegion
+    {
+        std::string name;
+        std::string filePath;
+        AbsRect source;
+        uint32_t page;
+        AbsRect destination;
+    };
+
+    class TextureAtlas
+    {
+        friend class TextureAtlasBuilder;
+
+    public:
+        bool hasRegion(const std::string &name) const;
+        const AtlasRegion &getRegion(const std::string &name) const;
+        std::vector<std::string> getRegionNames() const;
+
+        uint32_t getPageCount() const;
+        std::shared_ptr<ImageTexture> getPage(uint32_t page) const;
+        Size getPageSize() const;
+
+    private:
+        TextureAtlas() = default;
+
+        Size pageSize;
+        std::vector<std::shared_ptr<ImageTexture>> pages;
+        std::vector<AtlasRegion> regions;
+        std::unordered_map<std::string, size_t> regionIndex;
+    };
+}
+
+#endif  // BKENGINE_TEXTURE_ATLAS_H
@@ -0,0 +1,66 @@
+#ifndef BKENGINE_TEXTURE_CACHE_H
+#define BKENGINE_TEXTURE_CACHE_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "core/ImageTexture.h"
+#include "utils/Geometry.h"
+
+
+namespace bkengine
+{
+    class ImageInterface;
+
+    /**
+        Shares the pixel data of image textures rendered from the same file and clip.
+        The cache only holds weak references: the shared data lives as long as one of the
+        textures created from it. Interfaces whose textures cannot be cloned are not cached.
+        All methods are thread-safe.
+    */
+    class TextureCache
+    {
+    public:
+        std::shared_ptr<ImageTexture>
+        getImageTexture(ImageInterface &imageInterface, const std::string &filePath, const AbsRect &clip);
+        /**
+            Calls render on a miss to create the texture for the given key.
+            Throws a BuilderException if render returns nullptr.
+        */
+        std::shared_ptr<ImageTexture> getImageTexture(const std::string &filePath,
+                                                      const AbsRect &clip,
+                                                      const std::function<std::shared_ptr<ImageTexture>()> &render);
+
+        /** number of shared textures which are still in use */
+        size_t size();
+        void purge();
+
+        uint64_t getHitCount() const;
+        uint64_t getMissCount() const;
+
+    private:
+        struct Key
+        {
+            std::string filePath;
+            AbsRect clip;
+
+            bool operator==(const Key &key) const;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const;
+        };
+
+        std::mutex mutex;
+        std::unordered_map<Key, std::weak_ptr<ImageTexture>, KeyHash> entries;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+    };
+}
+
+#endif  // BKENGINE_TEXTURE_CACHE_H
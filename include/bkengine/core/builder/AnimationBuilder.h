@@ -3,11 +3,14 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "core/Animation.h"
 #include "core/Element.h"
 #include "core/utils/ElementUtils.h"
 #include "exceptions/BuilderException.h"
+#include "utils/MemoryResource.h"
+#include "utils/ObjectPool.h"
 
 
 namespace bkengine
@@ -21,7 +24,12 @@ namespace bkengine
         static AnimationBuilder createBuilder();
         AnimationBuilder &setName(const std::string &);
         AnimationBuilder &setParentElement(const std::shared_ptr<Element> &);
+        /**
+            Number of frames each texture is shown, measured at the nominal frame rate of 60 FPS.
+        */
         AnimationBuilder &setFramesPerTexture(uint32_t);
+        AnimationBuilder &setFrameDuration(double milliseconds);
+        AnimationBuilder &setFramesPerSecond(double);
 
         template <typename T>
         std::shared_ptr<T> build() const;
@@ -31,7 +39,7 @@ namespace bkengine
 
         std::string name;
         std::shared_ptr<Element> parentElement = nullptr;
-        uint32_t framesPerTexture = 60;
+        uint64_t frameDuration = 1000000;
     };
 }
 
@@ -3,12 +3,16 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "core/Element.h"
+#include "core/EventSubscription.h"
 #include "core/Scene.h"
 #include "core/utils/SceneUtils.h"
 #include "exceptions/BuilderException.h"
 #include "utils/Geometry.h"
+#include "utils/MemoryResource.h"
+#include "utils/ObjectPool.h"
 
 
 namespace bkengine
@@ -25,6 +29,11 @@ namespace bkengine
         ElementBuilder &setRenderBox(const RelRect &);
         ElementBuilder &setCollisionBox(const RelRect &);
         ElementBuilder &setCollisionLayer(uint32_t);
+        ElementBuilder &setThreadSafe(bool);
+        /**
+            Restricts the events passed to onEvent, the element receives every event if none is added.
+        */
+        ElementBuilder &addEventSubscription(const EventSubscription &);
 
         template <typename T>
         std::shared_ptr<T> build() const;
@@ -37,6 +46,8 @@ namespace bkengine
         Rect renderBox = {0, 0, 100, 100};
         Rect collisionBox = {0, 0, 100, 100};
         uint32_t collisionLayer = 0;
+        bool threadSafe = false;
+        std::vector<EventSubscription> subscriptions;
     };
 }
 
@@ -4,8 +4,15 @@
 #include <string>
 
 #include "core/Game.h"
+#include "interfaces/impl/NullFontInterface.h"
+#include "interfaces/impl/NullGraphicsInterface.h"
+#include "interfaces/impl/NullImageInterface.h"
+#include "interfaces/impl/ReplayEventInterface.h"
+#include "exceptions/BuilderException.h"
+#include "utils/EventCoalescer.h"
 #include "utils/Geometry.h"
 #include "utils/InterfaceContainer.h"
+#include "utils/JobSystem.h"
 
 
 namespace bkengine
@@ -21,6 +28,38 @@ namespace bkengine
         GameBuilder &setWindowTitle(const std::string &);
 
         GameBuilder &setIconFile(const std::string &);
+        GameBuilder &setWorkerCount(uint32_t);
+        /**
+            Directory in which decoded images are kept between runs, disabled if empty.
+            The directory has to exist.
+        */
+        GameBuilder &setImageCacheDirectory(const std::string &);
+        /** number of text layouts kept for reuse by text textures */
+        GameBuilder &setTextLayoutCacheSize(size_t);
+        /**
+            Polls the event interface on a separate thread which queues the events for the game loop,
+            so input is sampled while frames are running. The capacity has to be a power of two, otherwise
+            a BuilderException is thrown.
+            Only for event interfaces which may be polled from any thread.
+        */
+        GameBuilder &setInputThread(bool enabled, size_t queueCapacity = 1024);
+        /** merges consecutive events of the type within a frame, see EventCoalescer */
+        GameBuilder &setEventCoalescing(EventType, bool);
+        /** writes every event received by Game::run with its frame index to the file */
+        GameBuilder &setEventRecording(const std::string &filePath);
+        /**
+            Replaces the event interface with a ReplayEventInterface playing the recorded file.
+            Replays have to be polled directly, so the input thread is not used with them.
+        */
+        GameBuilder &setEventReplay(const std::string &filePath);
+        /**
+            Runs the game without a display as fast as possible: graphics, font and image interfaces
+            are replaced by their null implementations, frames are not delayed and advance by a fixed
+            delta of one frame at 60 FPS. Only every renderInterval-th frame is rendered, none if 0.
+        */
+        GameBuilder &setHeadless(bool enabled, uint32_t renderInterval = 0);
+        /** stops Game::run after the number of frames, 0 for no limit */
+        GameBuilder &setMaxFrames(uint64_t);
 
         template <typename T>
         GameBuilder &setEventInterface();
@@ -43,6 +82,17 @@ namespace bkengine
         Size windowSize = {1024, 768};
         std::string windowTitle = "BKEngine Test";
         std::string iconFile = "";
+        uint32_t workerCount = JobSystem::getDefaultWorkerCount();
+        std::string imageCacheDirectory = "";
+        size_t textLayoutCacheSize = TextLayoutCache::DEFAULT_CAPACITY;
+        bool inputThread = false;
+        size_t eventQueueCapacity = 1024;
+        EventCoalescer eventCoalescer;
+        std::string eventRecordingFile = "";
+        std::string eventReplayFile = "";
+        bool headless = false;
+        uint32_t renderInterval = 1;
+        uint64_t maxFrames = 0;
     };
 }
 
@@ -4,8 +4,11 @@
 #include <memory>
 #include <string>
 
+#include "core/AsyncTexture.h"
 #include "core/Game.h"
 #include "core/Texture.h"
+#include "core/TextureAtlas.h"
+#include "core/utils/GameUtils.h"
 #include "exceptions/BuilderException.h"
 #include "utils/Geometry.h"
 
@@ -23,25 +26,56 @@ namespace bkengine
         ImageTextureBuilder &setName(const std::string &);
         ImageTextureBuilder &setFilePath(const std::string &);
         ImageTextureBuilder &setClip(const AbsRect &);
+        /**
+            Draws the given region of an atlas instead of an image file.
+        */
+        ImageTextureBuilder &setAtlasRegion(const std::shared_ptr<TextureAtlas> &, const std::string &region);
         ImageTextureBuilder &setTexturePosition(const Point &);
         ImageTextureBuilder &setTextureSize(const RelRect &);
         ImageTextureBuilder &setRotation(double);
         ImageTextureBuilder &setFlip(bool horizontal, bool vertical);
+        /**
+            Texture rendered by asynchronously built textures until they are loaded.
+        */
+        ImageTextureBuilder &setPlaceholder(const std::shared_ptr<Texture> &);
+        /**
+            Textures of the same file and clip share their pixel data unless disabled.
+        */
+        ImageTextureBuilder &setCached(bool);
 
         std::shared_ptr<Texture> build() const;
+        /**
+            Returns immediately and loads the texture with the asset loader of the game.
+            Higher priorities are loaded first. Images are decoded on a worker if the image
+            interface supports decoding, the texture is created on the game loop thread.
+        */
+        std::shared_ptr<AsyncTexture> buildAsync(int32_t priority = 0) const;
 
     private:
         ImageTextureBuilder() = default;
 
+        void validate() const;
+        std::shared_ptr<Texture> build(Game &target, const DecodedImage *image = nullptr) const;
+        /** uploads the decoded image if given, otherwise renders the image */
+        std::shared_ptr<ImageTexture> renderImage(Game &target, const DecodedImage *image) const;
+        /** reads the encoded image from a mounted archive or its file, nothing if it could not be read */
+        AssetData readImage(Game &target, bool &packed) const;
+        /** decodes with the disk cache of the game, if any, without creating textures */
+        bool decodeImage(Game &target, const AssetData &data, DecodedImage &image) const;
+
         std::shared_ptr<Game> game = nullptr;
         std::string name;
         std::string filePath;
         Rect clipRect = {0, 0, 0, 0};
+        std::shared_ptr<TextureAtlas> atlas = nullptr;
+        std::string regionName;
         Point position = {0, 0};
         Rect textureSize = {0, 0, 100, 100};
         double angleRadians = 0;
         bool flipHorizontally = false;
         bool flipVertically = false;
+        std::shared_ptr<Texture> placeholder = nullptr;
+        bool cached = true;
     };
 }
 
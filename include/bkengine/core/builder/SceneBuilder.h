@@ -8,6 +8,8 @@
 #include "core/Scene.h"
 #include "core/utils/GameUtils.h"
 #include "exceptions/BuilderException.h"
+#include "utils/MemoryResource.h"
+#include "utils/ObjectPool.h"
 
 namespace bkengine
 {
@@ -20,6 +22,20 @@ namespace bkengine
         static SceneBuilder createBuilder();
         SceneBuilder &setName(const std::string &);
         SceneBuilder &setParentGame(const std::shared_ptr<Game> &);
+        SceneBuilder &setParallelUpdate(bool);
+        SceneBuilder &setUpdateGrainSize(uint32_t);
+        /**
+            Elements and animations created for the scene before it runs are placed in an arena
+            starting with the given number of bytes and released in one go once the scene and its
+            objects are gone. Memory of objects freed earlier is never reused, so objects created
+            while the scene runs come from the object pools. 0 disables the arena.
+        */
+        SceneBuilder &setArenaSize(size_t);
+        /**
+            Mouse, motion and wheel events are only passed to the elements whose render box contains
+            the cursor, starting with the top-most one, until an element's onEvent returns true.
+        */
+        SceneBuilder &setHitTesting(bool);
 
         template <typename T>
         std::shared_ptr<T> build() const;
@@ -33,6 +49,10 @@ namespace bkengine
 
         std::string name;
         std::shared_ptr<Game> parentGame = nullptr;
+        bool parallelUpdate = false;
+        uint32_t updateGrainSize = 0;
+        size_t arenaSize = 0;
+        bool hitTesting = false;
     };
 }
 
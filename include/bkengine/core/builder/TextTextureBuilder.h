@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 
+#include "core/AsyncTexture.h"
 #include "core/Game.h"
 #include "core/TextTexture.h"
 #include "exceptions/BuilderException.h"
@@ -29,12 +30,33 @@ namespace bkengine
         TextTextureBuilder &setTextureSize(const RelRect &);
         TextTextureBuilder &setRotation(double);
         TextTextureBuilder &setFlip(bool horizontal, bool vertical);
+        /**
+            Texture rendered by asynchronously built textures until they are loaded.
+        */
+        TextTextureBuilder &setPlaceholder(const std::shared_ptr<Texture> &);
+        /**
+            Text is drawn from the glyph atlas of its font, size and quality if the font interface
+            supports it, unless disabled.
+        */
+        TextTextureBuilder &setCached(bool);
 
         std::shared_ptr<Texture> build() const;
+        /**
+            Returns immediately and loads the texture with the asset loader of the game.
+            Higher priorities are loaded first. Glyphs are rasterized on a worker, atlas pages
+            and the texture are created on the game loop thread.
+        */
+        std::shared_ptr<AsyncTexture> buildAsync(int32_t priority = 0) const;
 
     private:
         TextTextureBuilder() = default;
 
+        void validate() const;
+        std::shared_ptr<Texture> build(Game &target, const GlyphBitmaps *rasterized = nullptr) const;
+        std::shared_ptr<TextTexture> renderGlyphRun(Game &target, const GlyphBitmaps *rasterized) const;
+        /** rasterizes the glyphs missing in the atlas of the text, without creating textures */
+        std::shared_ptr<GlyphBitmaps> rasterize(Game &target) const;
+
         std::shared_ptr<Game> game = nullptr;
         std::string name;
         std::string text;
@@ -46,6 +68,8 @@ namespace bkengine
         double angleRadians = 0;
         bool flipHorizontally = false;
         bool flipVertically = false;
+        std::shared_ptr<Texture> placeholder = nullptr;
+        bool cached = true;
     };
 }
 
@@ -0,0 +1,50 @@
+#ifndef BKENGINE_TEXTURE_ATLAS_BUILDER_H
+#define BKENGINE_TEXTURE_ATLAS_BUILDER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/Game.h"
+#include "core/TextureAtlas.h"
+#include "exceptions/BuilderException.h"
+#include "exceptions/NameAlreadyExistsException.h"
+#include "utils/Geometry.h"
+#include "utils/RectPacker.h"
+
+
+namespace bkengine
+{
+    class Game;
+
+    class TextureAtlasBuilder
+    {
+    public:
+        static TextureAtlasBuilder createBuilder();
+        TextureAtlasBuilder &setGame(const std::shared_ptr<Game> &);
+        TextureAtlasBuilder &setPageSize(const Size &);
+        TextureAtlasBuilder &setPadding(uint32_t);
+        /**
+            Adds the given part of an image file, the whole image if the clip is empty.
+        */
+        TextureAtlasBuilder &
+        addImage(const std::string &name, const std::string &filePath, const AbsRect &clip = {0, 0, 0, 0});
+
+        /**
+            Packs the images without rendering anything. Needs no game if every image has a clip,
+            so layouts can be computed offline.
+        */
+        std::vector<AtlasRegion> buildLayout() const;
+        std::shared_ptr<TextureAtlas> build() const;
+
+    private:
+        TextureAtlasBuilder() = default;
+
+        std::shared_ptr<Game> game = nullptr;
+        Size pageSize = {2048, 2048};
+        uint32_t padding = 1;
+        std::vector<AtlasRegion> images;
+    };
+}
+
+#endif  // BKENGINE_TEXTURE_ATLAS_BUILDER_H
@@ -1,5 +1,19 @@
 namespace bkengine
 {
+    /** true unless T inherits Animation::onRender() unchanged */
+    template <typename T, typename = void>
+    struct OverridesRenderHook : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct OverridesRenderHook<
+        T,
+        typename std::enable_if<std::is_same<decltype(&T::onRender), bool (Animation::*)()>::value>::type>
+        : std::false_type
+    {
+    };
+
     template <typename T>
     std::shared_ptr<T> AnimationBuilder::build() const
     {
@@ -11,13 +25,20 @@ namespace bkengine
             throw BuilderException("You have to specify a name for the element!");
         }
 
-        auto animation = std::static_pointer_cast<Animation>(std::make_shared<wrapper>());
+        std::shared_ptr<Animation> animation;
+        auto memoryResource = parentElement != nullptr ? parentElement->getMemoryResource() : nullptr;
+        if (memoryResource != nullptr) {
+            animation = std::allocate_shared<wrapper>(ResourceAllocator<wrapper>(memoryResource));
+        } else {
+            animation = std::allocate_shared<wrapper>(PoolAllocator<wrapper>());
+        }
         animation->name = name;
-        animation->framesPerTexture = framesPerTexture;
+        animation->frameDuration = frameDuration;
+        animation->renderHook = OverridesRenderHook<T>::value;
 
         if (parentElement != nullptr) {
             ElementUtils::addAnimation(parentElement, animation);
         }
-        return animation;
+        return std::static_pointer_cast<T>(animation);
     }
 }
\ No newline at end of file
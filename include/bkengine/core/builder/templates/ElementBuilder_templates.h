@@ -11,14 +11,23 @@ namespace bkengine
             throw BuilderException("You have to specify a name for the scene!");
         }
         
-        auto element = std::static_pointer_cast<Element>(std::make_shared<wrapper>());
+        std::shared_ptr<Element> element;
+        auto memoryResource = parentScene != nullptr ? parentScene->getMemoryResource() : nullptr;
+        if (memoryResource != nullptr) {
+            element = std::allocate_shared<wrapper>(ResourceAllocator<wrapper>(memoryResource));
+        } else {
+            element = std::allocate_shared<wrapper>(PoolAllocator<wrapper>());
+        }
         element->name = std::move(name);
         element->renderBox = renderBox;
         element->collisionBox = collisionBox;
+        element->threadSafe = threadSafe;
+        element->subscribedToAll = subscriptions.empty();
+        element->subscriptions = subscriptions;
 
         if (parentScene != nullptr) {
             SceneUtils::addElement(parentScene, element, collisionLayer);
         }
-        return element;
+        return std::static_pointer_cast<T>(element);
     }
 }
\ No newline at end of file
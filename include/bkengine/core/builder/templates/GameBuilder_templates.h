@@ -42,12 +42,41 @@ namespace bkengine
         {
         };
 
+        InterfaceContainer interfaces = interfaceContainer;
+        if (!eventReplayFile.empty()) {
+            interfaces.setEventInterface<ReplayEventInterface>();
+            auto replay = std::static_pointer_cast<ReplayEventInterface>(interfaces.getEventInterface());
+            replay->loadFromFile(eventReplayFile);
+        }
+        if (headless) {
+            interfaces.setGraphicsInterface<NullGraphicsInterface>();
+            interfaces.setFontInterface<NullFontInterface>();
+            interfaces.setImageInterface<NullImageInterface>();
+        }
+
         auto game = std::static_pointer_cast<Game>(std::make_shared<wrapper>());
-        game->interfaceContainer = interfaceContainer;
+        game->interfaceContainer = interfaces;
+        game->jobSystem = std::make_shared<JobSystem>(workerCount);
+        game->assetLoader = std::make_shared<AssetLoader>(game->jobSystem);
+        game->textLayoutCache.setCapacity(textLayoutCacheSize);
+        game->eventCoalescer = eventCoalescer;
+        game->headless = headless;
+        game->renderInterval = renderInterval;
+        game->maxFrames = maxFrames;
+        if (!eventRecordingFile.empty()) {
+            game->eventRecorder = std::make_shared<EventRecorder>(eventRecordingFile);
+        }
+        if (inputThread && eventReplayFile.empty()) {
+            game->eventQueue.reset(new SpscQueue<Event>(eventQueueCapacity));
+            game->eventBuffer.resize(std::min<size_t>(eventQueueCapacity, 256));
+        }
+        if (!imageCacheDirectory.empty()) {
+            game->imageDiskCache = std::make_shared<ImageDiskCache>(imageCacheDirectory);
+        }
         game->setWindowSize(windowSize);
         game->setWindowTitle(windowTitle);
         game->setIconFile(iconFile);
         
-        return game;
+        return std::static_pointer_cast<T>(game);
     }
 }
\ No newline at end of file
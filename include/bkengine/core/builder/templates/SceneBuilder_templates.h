@@ -11,13 +11,19 @@ namespace bkengine
             throw BuilderException("You have to specify a name for the scene!");
         }
 
-        auto scene = std::static_pointer_cast<Scene>(std::make_shared<wrapper>());
+        auto scene = std::static_pointer_cast<Scene>(std::allocate_shared<wrapper>(PoolAllocator<wrapper>()));
         scene->name = name;
+        scene->parallelUpdate = parallelUpdate;
+        scene->updateGrainSize = updateGrainSize;
+        scene->hitTesting = hitTesting;
+        if (arenaSize > 0) {
+            scene->arena = std::make_shared<MonotonicBufferResource>(arenaSize);
+        }
 
         if (parentGame != nullptr) {
             GameUtils::addScene(parentGame, scene);
         }
-        return scene;
+        return std::static_pointer_cast<T>(scene);
     }
 
     template <typename T>
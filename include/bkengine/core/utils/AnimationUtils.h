@@ -34,6 +34,8 @@ namespace bkengine
 
     private:
         AnimationUtils() = delete;
+
+        static void markDirty(const std::shared_ptr<Animation> &animation);
     };
 }
 
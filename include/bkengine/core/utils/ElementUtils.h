@@ -6,6 +6,7 @@
 
 #include "core/Animation.h"
 #include "core/Element.h"
+#include "core/EventSubscription.h"
 #include "exceptions/NameAlreadyExistsException.h"
 #include "exceptions/NameNotFoundException.h"
 
@@ -32,8 +33,19 @@ namespace bkengine
         static void activateAnimation(const std::shared_ptr<Element> &element, const std::string &name);
         static std::shared_ptr<Animation> getCurrentAnimation(const std::shared_ptr<Element> &element);
 
+        /**
+            Elements receive every event until they subscribe to specific ones.
+        */
+        static void subscribe(const std::shared_ptr<Element> &element, const EventSubscription &subscription);
+        static void unsubscribeAll(const std::shared_ptr<Element> &element);
+        static void subscribeToAll(const std::shared_ptr<Element> &element);
+        static std::vector<EventSubscription> getSubscriptions(const std::shared_ptr<Element> &element);
+        static bool isSubscribedToAll(const std::shared_ptr<Element> &element);
+
     private:
         ElementUtils() = delete;
+
+        static void markSubscriptionsDirty(const std::shared_ptr<Element> &element);
     };
 }
 
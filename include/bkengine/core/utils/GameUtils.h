@@ -8,6 +8,8 @@
 #include "core/Scene.h"
 #include "exceptions/NameAlreadyExistsException.h"
 #include "exceptions/NameNotFoundException.h"
+#include "exceptions/NullPointerException.h"
+#include "utils/AssetArchive.h"
 
 
 namespace bkengine
@@ -30,6 +32,20 @@ namespace bkengine
         static void activateScene(const std::shared_ptr<Game> &game, const std::string &name);
         static std::shared_ptr<Scene> getCurrentScene(const std::shared_ptr<Game> &game);
 
+        /**
+            Texture builders and registerFont look up file paths in the mounted archives first,
+            the archive mounted last wins.
+        */
+        static void mountArchive(const std::shared_ptr<Game> &game, const std::shared_ptr<AssetArchive> &archive);
+        static void unmountArchive(const std::shared_ptr<Game> &game, const std::shared_ptr<AssetArchive> &archive);
+        static bool findAsset(const std::shared_ptr<Game> &game, const std::string &name, AssetData &data);
+        static bool findAsset(Game &game, const std::string &name, AssetData &data);
+
+        static void registerFont(const std::shared_ptr<Game> &game,
+                                 const std::string &filePath,
+                                 const std::string &fontName,
+                                 double size);
+
     private:
         GameUtils() = delete;
     };
@@ -2,6 +2,7 @@
 #define BKENGINE_SCENE_UTILS_H
 
 #include <memory>
+#include <unordered_set>
 
 #include "core/Element.h"
 #include "core/Scene.h"
@@ -37,8 +38,34 @@ namespace bkengine
                                                 const std::string &name,
                                                 uint32_t collisionLayerIndex);
 
+        /**
+            Applies the structural changes which were recorded while the scene dispatched events or
+            updated its elements. All changes are applied in one batch, the element list and the
+            collision layers are updated once per batch.
+            While changes are deferred all queries (elements, names, counts and collision layers) already
+            reflect them and added elements already belong to the scene, the stored element list and
+            collision layers are updated when the batch is applied.
+            Called by the scene before and after its update.
+        */
+        static void applyDeferredChanges(const std::shared_ptr<Scene> &scene);
+
+        /**
+            Sends all mouse, motion and wheel events to the element until released or the element
+            is removed, e.g. while it is dragged.
+        */
+        static void capturePointer(const std::shared_ptr<Scene> &scene, const std::shared_ptr<Element> &element);
+        static void releasePointer(const std::shared_ptr<Scene> &scene);
+        static std::shared_ptr<Element> getPointerCapture(const std::shared_ptr<Scene> &scene);
+
     private:
         SceneUtils() = delete;
+
+        static std::shared_ptr<Element> findInIndex(const std::shared_ptr<Scene> &scene, const std::string &name);
+        static std::shared_ptr<Element> findElement(const std::shared_ptr<Scene> &scene, const std::string &name);
+        static std::vector<std::shared_ptr<Element>> getElements(const std::shared_ptr<Scene> &scene);
+        static bool isDeferring(const std::shared_ptr<Scene> &scene);
+        static void eraseFromCollisionLayer(const std::shared_ptr<Scene> &scene,
+                                            const std::shared_ptr<Element> &element);
     };
 }
 
@@ -0,0 +1,16 @@
+#ifndef BKENGINE_ARCHIVE_EXCEPTION_H
+#define BKENGINE_ARCHIVE_EXCEPTION_H
+
+#include <stdexcept>
+
+
+namespace bkengine
+{
+    class ArchiveException : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+}
+
+#endif  // BKENGINE_ARCHIVE_EXCEPTION_H
@@ -0,0 +1,16 @@
+#ifndef BKENGINE_EVENT_LOG_EXCEPTION_H
+#define BKENGINE_EVENT_LOG_EXCEPTION_H
+
+#include <stdexcept>
+
+
+namespace bkengine
+{
+    class EventLogException : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+}
+
+#endif  // BKENGINE_EVENT_LOG_EXCEPTION_H
@@ -1,6 +1,8 @@
 #ifndef BKENGINE_EVENTINTERFACE_H
 #define BKENGINE_EVENTINTERFACE_H
 
+#include <cstdint>
+
 #include "utils/Event.h"
 
 
@@ -11,6 +13,11 @@ namespace bkengine
         public:
             virtual bool ready() = 0;
             virtual Event poll() = 0;
+
+            /** called by Game::run before the events of a frame are polled, unless an input thread polls */
+            virtual void beginFrame(uint64_t frame)
+            {
+            }
     };
 }
 
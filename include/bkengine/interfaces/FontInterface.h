@@ -3,18 +3,73 @@
 
 #include <string>
 
+#include "core/GlyphAtlas.h"
+#include "core/GlyphRunTexture.h"
+#include "core/ImageTexture.h"
 #include "core/TextTexture.h"
+#include "utils/AssetArchive.h"
 
 
 namespace bkengine
 {
+    /**
+        Asynchronous text builds call renderGlyph on the workers of the job system, so it has to be
+        thread-safe. Every other function is called on the thread building the texture, which is
+        the game loop thread for asynchronous builds.
+    */
     class FontInterface
     {
     public:
         virtual void registerFont(const std::string &filePath, const std::string &fontName, double size) = 0;
+        /**
+            Registers a font held in memory, the interface may keep data.owner as long as it needs the bytes.
+            Returns false if not supported, the font is then loaded by its path.
+        */
+        virtual bool registerFontData(const AssetData &data, const std::string &fontName, double size)
+        {
+            return false;
+        }
 
         virtual std::shared_ptr<TextTexture>
         renderFontToTexture(const std::string &text, const std::string &fontName, double size, TextQuality) = 0;
+
+        /*
+            Glyph atlas support. Interfaces without it keep the defaults, in which case
+            every text is rendered with renderFontToTexture.
+        */
+
+        /** rasterizes a single glyph of a registered font */
+        virtual bool renderGlyph(const std::string &fontName,
+                                 double size,
+                                 TextQuality,
+                                 uint32_t codepoint,
+                                 GlyphBitmap &glyph)
+        {
+            return false;
+        }
+
+        /**
+            Creates an empty, transparent atlas page for glyphs of the given quality. Pages of
+            TextQuality::SDF hold distance fields instead of coverage: 128 lies on the outline, so
+            they have to be drawn with an alpha test or a smoothstep around 128, never as alpha.
+        */
+        virtual std::shared_ptr<ImageTexture> createGlyphPage(const Size &size, TextQuality quality)
+        {
+            return nullptr;
+        }
+
+        /** writes the coverage, or the distance field for SDF pages, of a glyph to the destination of a page */
+        virtual void updateGlyphPage(const std::shared_ptr<ImageTexture> &page,
+                                     const AbsRect &destination,
+                                     const GlyphBitmap &glyph)
+        {
+        }
+
+        /** creates an empty text texture drawing the quads of its glyph atlas */
+        virtual std::shared_ptr<GlyphRunTexture> createGlyphRunTexture()
+        {
+            return nullptr;
+        }
     };
 }
 
@@ -2,18 +2,78 @@
 #define BKENGINE_IMAGEINTERFACE_H
 
 #include <string>
+#include <vector>
 
 #include "core/ImageTexture.h"
+#include "core/TextureAtlas.h"
+#include "utils/AssetArchive.h"
+#include "utils/ImageDiskCache.h"
 
 
 namespace bkengine
 {
+    /**
+        Asynchronous image builds call decodeImage on the workers of the job system, so it has to be
+        thread-safe. Every other function is called on the thread building the texture, which is
+        the game loop thread for asynchronous builds.
+    */
     class ImageInterface
     {
     public:
         virtual std::shared_ptr<ImageTexture> renderImageFileToTexture(const std::string &filePath,
                                                                        const AbsRect &) = 0;
+
+        /**
+            Renders an encoded image held in memory, e.g. an entry of an asset archive.
+            Returns nullptr if not supported, the image is then loaded by its path.
+        */
+        virtual std::shared_ptr<ImageTexture> renderImageDataToTexture(const AssetData &data, const AbsRect &)
+        {
+            return nullptr;
+        }
+
+        /*
+            Decoding support for the decoded image cache of the game. Interfaces without it keep
+            the defaults, in which case images are always rendered from their encoded data.
+        */
+
+        /** decodes an encoded image to premultiplied RGBA pixels */
+        virtual bool decodeImage(const AssetData &data, DecodedImage &image)
+        {
+            return false;
+        }
+
+        /** creates a texture from decoded pixels */
+        virtual std::shared_ptr<ImageTexture> uploadImage(const DecodedImage &image, const AbsRect &)
+        {
+            return nullptr;
+        }
+
+        /*
+            Texture atlas support. Interfaces without it keep the defaults, in which case
+            TextureAtlasBuilder::build and atlas based textures fail with a BuilderException.
+        */
+
+        /** size of the image file in pixels */
+        virtual Size getImageSize(const std::string &filePath)
+        {
+            return {0, 0};
+        }
+
+        /** draws the source of every region to its destination on a new texture of the given size */
+        virtual std::shared_ptr<ImageTexture> renderAtlasPage(const Size &pageSize,
+                                                              const std::vector<AtlasRegion> &regions)
+        {
+            return nullptr;
+        }
+
+        /** creates a texture drawing the given part of an atlas page, sharing the page's pixel data */
+        virtual std::shared_ptr<ImageTexture> createPageTexture(const std::shared_ptr<ImageTexture> &page,
+                                                                const AbsRect &clip)
+        {
+            return nullptr;
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,33 @@
+#ifndef BKENGINE_NULLFONTINTERFACE_H
+#define BKENGINE_NULLFONTINTERFACE_H
+
+#include <memory>
+#include <string>
+
+#include "interfaces/FontInterface.h"
+
+
+namespace bkengine
+{
+    /** text texture without pixels, rendering it does nothing */
+    class NullTextTexture : public TextTexture
+    {
+        public:
+            virtual void onRender() override;
+    };
+
+    /** font interface for headless runs, which never reads font files or rasterizes glyphs */
+    class NullFontInterface : public FontInterface
+    {
+        public:
+            virtual void registerFont(const std::string &filePath, const std::string &fontName, double size) override;
+            virtual bool registerFontData(const AssetData &data, const std::string &fontName, double size) override;
+
+            virtual std::shared_ptr<TextTexture> renderFontToTexture(const std::string &text,
+                                                                     const std::string &fontName,
+                                                                     double size,
+                                                                     TextQuality) override;
+    };
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef BKENGINE_NULLGRAPHICSINTERFACE_H
+#define BKENGINE_NULLGRAPHICSINTERFACE_H
+
+#include "interfaces/GraphicsInterface.h"
+
+
+namespace bkengine
+{
+    /**
+        Graphics interface without a window for headless runs. Only remembers the window
+        properties, drawing and delays do nothing.
+    */
+    class NullGraphicsInterface : public GraphicsInterface
+    {
+        public:
+            virtual bool initWindow(Size size, const std::string &title) override;
+            virtual std::string getLastError() override;
+
+            virtual void setWindowSize(Size size) override;
+            virtual Size getWindowSize() override;
+
+            virtual void setWindowTitle(const std::string &title) override;
+            virtual std::string getWindowTitle() override;
+
+            virtual void delay(uint32_t) override;
+
+            virtual bool setIcon(const std::string &) override;
+
+            virtual void clear() override;
+            virtual void draw() override;
+
+        protected:
+            Size windowSize = {0, 0};
+            std::string windowTitle = "";
+    };
+}
+
+#endif
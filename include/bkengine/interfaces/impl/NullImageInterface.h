@@ -0,0 +1,34 @@
+#ifndef BKENGINE_NULLIMAGEINTERFACE_H
+#define BKENGINE_NULLIMAGEINTERFACE_H
+
+#include <memory>
+#include <string>
+
+#include "interfaces/ImageInterface.h"
+
+
+namespace bkengine
+{
+    /** image texture without pixels, rendering it does nothing */
+    class NullImageTexture : public ImageTexture
+    {
+        public:
+            virtual void onRender() override;
+            virtual std::shared_ptr<ImageTexture> clone() const override;
+    };
+
+    /**
+        Image interface for headless runs, which never reads image files. Texture atlases are not
+        supported, since the image sizes are unknown without decoding.
+    */
+    class NullImageInterface : public ImageInterface
+    {
+        public:
+            virtual std::shared_ptr<ImageTexture> renderImageFileToTexture(const std::string &filePath,
+                                                                           const AbsRect &) override;
+            virtual std::shared_ptr<ImageTexture> renderImageDataToTexture(const AssetData &data,
+                                                                           const AbsRect &) override;
+    };
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef BKENGINE_REPLAYEVENTINTERFACE_H
+#define BKENGINE_REPLAYEVENTINTERFACE_H
+
+#include <string>
+#include <vector>
+
+#include "interfaces/EventInterface.h"
+#include "utils/EventLog.h"
+#include "utils/Logger.h"
+
+
+namespace bkengine
+{
+    /**
+        Feeds recorded events back in the frames they were recorded in. Emits a QUIT event after
+        the last recorded frame if the log does not end with one, so replays always terminate.
+        Restarts from the beginning when Game::run starts over.
+    */
+    class ReplayEventInterface : public EventInterface
+    {
+        public:
+            void loadFromFile(const std::string &filename);
+            void setEvents(const std::vector<RecordedEvent> &events);
+
+            virtual void beginFrame(uint64_t frame) override;
+            virtual bool ready() override;
+            virtual Event poll() override;
+
+            /** true once every recorded event has been replayed */
+            bool isFinished() const;
+
+        protected:
+            std::vector<RecordedEvent> events;
+            size_t next = 0;
+            uint64_t frame = 0;
+            bool quitSent = false;
+    };
+}
+
+#endif
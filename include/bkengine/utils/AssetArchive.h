@@ -0,0 +1,101 @@
+#ifndef BKENGINE_ASSET_ARCHIVE_H
+#define BKENGINE_ASSET_ARCHIVE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "exceptions/ArchiveException.h"
+#include "exceptions/NameAlreadyExistsException.h"
+#include "exceptions/NameNotFoundException.h"
+
+
+namespace bkengine
+{
+    /**
+        Read-only view of an asset's bytes. The owner keeps the bytes alive.
+    */
+    struct AssetData
+    {
+        const uint8_t *data;
+        size_t size;
+        std::shared_ptr<const void> owner;
+    };
+
+    /**
+        Packed asset archive, all numbers are little endian:
+
+            header  magic "BKPA", version (u32), entry count (u32), reserved (u32),
+                    index offset (u64), index size (u64)
+            blobs   entry data, each starting at a multiple of ALIGNMENT
+            index   per entry: name length (u32), flags (u32), offset (u64),
+                    stored size (u64), size (u64), name
+
+        Entries flagged with FLAG_LZ4 hold a single LZ4 block.
+        The archive file is memory-mapped, uncompressed entries are returned without copying.
+    */
+    class AssetArchive : public std::enable_shared_from_this<AssetArchive>
+    {
+    public:
+        static const uint32_t VERSION = 1;
+        static const uint32_t ALIGNMENT = 16;
+        static const uint32_t FLAG_LZ4 = 1;
+
+        struct Entry
+        {
+            uint64_t offset;
+            uint64_t storedSize;
+            uint64_t size;
+            uint32_t flags;
+        };
+
+        static std::shared_ptr<AssetArchive> open(const std::string &filePath);
+        ~AssetArchive();
+
+        AssetArchive(const AssetArchive &) = delete;
+        AssetArchive &operator=(const AssetArchive &) = delete;
+
+        bool hasEntry(const std::string &name) const;
+        const Entry &getEntry(const std::string &name) const;
+        std::vector<std::string> getEntryNames() const;
+        AssetData getData(const std::string &name) const;
+
+        std::string getFilePath() const;
+
+    private:
+        AssetArchive() = default;
+
+        void readIndex();
+
+        std::string filePath;
+        const uint8_t *mapping = nullptr;
+        size_t mappingSize = 0;
+        std::vector<uint8_t> buffer;
+
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    class AssetArchiveWriter
+    {
+    public:
+        AssetArchiveWriter &addEntry(const std::string &name, const std::vector<uint8_t> &data, bool compress = false);
+        AssetArchiveWriter &addFile(const std::string &name, const std::string &filePath, bool compress = false);
+
+        void write(const std::string &filePath) const;
+
+    private:
+        struct PendingEntry
+        {
+            std::string name;
+            std::vector<uint8_t> data;
+            uint64_t size;
+            uint32_t flags;
+        };
+
+        std::vector<PendingEntry> pendingEntries;
+    };
+}
+
+#endif  // BKENGINE_ASSET_ARCHIVE_H
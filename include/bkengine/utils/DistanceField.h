@@ -0,0 +1,39 @@
+#ifndef BKENGINE_DISTANCE_FIELD_H
+#define BKENGINE_DISTANCE_FIELD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace bkengine
+{
+    /**
+        Signed distance fields computed with the exact euclidean distance transform of
+        Felzenszwalb and Huttenlocher.
+    */
+    class DistanceField
+    {
+    public:
+        /**
+            Converts 8 bit coverage (inside from 128 on) to a distance field padded by spread pixels
+            on every side. 128 lies on the outline, values grow by 127 / spread per pixel towards
+            the inside and are clamped at spread pixels from the outline.
+        */
+        static std::vector<uint8_t> generate(const uint8_t *coverage, uint32_t width, uint32_t height, uint32_t spread);
+
+        /**
+            Squared distance of every cell to the nearest cell with a value of zero, in place.
+            Cells which are not features have to hold a large value, e.g. getInfinity().
+        */
+        static void transform(std::vector<double> &grid, uint32_t width, uint32_t height);
+        static double getInfinity();
+
+    private:
+        DistanceField() = delete;
+
+        static void transform(const double *input, size_t size, double *output, size_t *vertices, double *bounds);
+    };
+}
+
+#endif  // BKENGINE_DISTANCE_FIELD_H
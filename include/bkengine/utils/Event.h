@@ -1,8 +1,8 @@
 #ifndef BKENGINE_EVENT_H
 #define BKENGINE_EVENT_H
 
-#include <chrono>
-#include <vector>
+#include <cstdint>
+#include <type_traits>
 
 #include "Keys.h"
 
@@ -28,7 +28,8 @@ namespace bkengine
         MOUSE,
         MOTION,
         WHEEL,
-        QUIT
+        QUIT,
+        WINDOW
     };
 
     enum class WindowEventType {
@@ -81,20 +82,24 @@ namespace bkengine
 
     struct WindowEvent {
         WindowEventType type;
-        std::vector<int32_t> data;
+        int32_t data1;
+        int32_t data2;
     };
 
+    /**
+        Fixed-size, trivially copyable event without heap allocations. The timestamp is set by the producer,
+        usually to getTimestamp() when the event was sampled.
+    */
     class Event
     {
         public:
             Event() {}
-            virtual ~Event() {}
-            Event(const Event &event);
-            Event &operator=(const Event &event);
+
+            /** nanoseconds on a monotonic clock */
+            static uint64_t getTimestamp();
 
             EventType type = EventType::UNKNOWN;
-            uint32_t timeStamp = std::chrono::duration_cast<std::chrono::seconds>
-                                 (std::chrono::system_clock::now().time_since_epoch()).count();
+            uint64_t timestamp = 0;
             uint32_t windowId = 0;
 
             union {
@@ -105,6 +110,8 @@ namespace bkengine
                 WindowEvent window;
             };
     };
+
+    static_assert(std::is_trivially_copyable<Event>::value, "events are copied into queues byte by byte");
 }
 
 #endif
@@ -0,0 +1,47 @@
+#ifndef BKENGINE_EVENT_COALESCER_H
+#define BKENGINE_EVENT_COALESCER_H
+
+#include <cstddef>
+
+#include "utils/Event.h"
+
+
+namespace bkengine
+{
+    /**
+        Merges runs of consecutive events of the same type before they are dispatched.
+        Motion events sum their relative motion and keep the last absolute position, wheel events
+        sum their motion as long as the direction does not change. Events of other types and events
+        of different windows are never merged and keep their order.
+    */
+    class EventCoalescer
+    {
+    public:
+        /** only EventType::MOTION and EventType::WHEEL can be coalesced */
+        static bool isCoalescible(EventType);
+
+        void setCoalescing(EventType, bool);
+        bool isCoalescing(EventType) const;
+        /** true if any event type is coalesced */
+        bool isEnabled() const;
+
+        /**
+            Adds the next event. Returns true and sets completed if an event is ready for dispatch,
+            which may be an earlier one. Every batch has to end with flush().
+        */
+        bool add(const Event &event, Event &completed);
+        /** returns the pending event, if any, at the end of a batch */
+        bool flush(Event &completed);
+
+    private:
+        static const size_t TYPE_COUNT = static_cast<size_t>(EventType::WINDOW) + 1;
+
+        bool merge(const Event &);
+
+        bool coalescing[TYPE_COUNT] = {false};
+        bool hasPending = false;
+        Event pending;
+    };
+}
+
+#endif  // BKENGINE_EVENT_COALESCER_H
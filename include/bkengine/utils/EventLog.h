@@ -0,0 +1,57 @@
+#ifndef BKENGINE_EVENT_LOG_H
+#define BKENGINE_EVENT_LOG_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "exceptions/EventLogException.h"
+#include "utils/Event.h"
+#include "utils/Keys.h"
+
+
+namespace bkengine
+{
+    struct RecordedEvent {
+        /** index of the frame the event was polled in, counted from the start of Game::run */
+        uint64_t frame;
+        Event event;
+    };
+
+    /**
+        Appends events with their frame index to a binary log. Records store the frame as a delta to
+        the previous record and only the fields of the event type, so a record takes a few bytes.
+    */
+    class EventRecorder
+    {
+    public:
+        explicit EventRecorder(const std::string &filePath);
+
+        void record(uint64_t frame, const Event &);
+        /** writes the buffered records to the file, does nothing if there are none */
+        void flush();
+
+        uint64_t getCount() const;
+        const std::string &getFilePath() const;
+
+    private:
+        std::string filePath;
+        std::ofstream file;
+        uint64_t lastFrame = 0;
+        uint64_t count = 0;
+        uint64_t flushedCount = 0;
+    };
+
+    class EventLog
+    {
+    private:
+        EventLog() = delete;
+
+    public:
+        /** reads every record of a log written by EventRecorder */
+        static std::vector<RecordedEvent> load(const std::string &filePath);
+    };
+}
+
+#endif  // BKENGINE_EVENT_LOG_H
@@ -0,0 +1,50 @@
+#ifndef BKENGINE_IMAGE_DISK_CACHE_H
+#define BKENGINE_IMAGE_DISK_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace bkengine
+{
+    /**
+        Decoded image with 8 bit RGBA pixels, row by row without padding.
+    */
+    struct DecodedImage
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint8_t> pixels;
+
+        /** multiplies the color channels with alpha, for decoders returning straight alpha */
+        void premultiplyAlpha();
+    };
+
+    /**
+        Stores decoded images in a directory, keyed by the hash of their encoded content,
+        so that images only have to be decoded once. The directory has to exist.
+        Files are written to a temporary name and renamed, so concurrent readers never see
+        partially written images.
+    */
+    class ImageDiskCache
+    {
+    public:
+        explicit ImageDiskCache(const std::string &directory);
+
+        /** 64 bit FNV-1a */
+        static uint64_t hash(const uint8_t *data, size_t size);
+
+        bool load(uint64_t hash, DecodedImage &image) const;
+        bool store(uint64_t hash, const DecodedImage &image) const;
+        void remove(uint64_t hash) const;
+
+        std::string getDirectory() const;
+        std::string getFilePath(uint64_t hash) const;
+
+    private:
+        std::string directory;
+    };
+}
+
+#endif  // BKENGINE_IMAGE_DISK_CACHE_H
@@ -0,0 +1,61 @@
+#ifndef BKENGINE_INPUT_STATE_H
+#define BKENGINE_INPUT_STATE_H
+
+#include <bitset>
+#include <cstdint>
+
+#include "utils/Event.h"
+#include "utils/Geometry.h"
+#include "utils/Keys.h"
+
+
+namespace bkengine
+{
+    /**
+        Keyboard and mouse state of the current frame, updated by Game::run with every polled event.
+        Presses and releases are remembered for the frame they happened in, so a key pressed and
+        released within one frame is reported by both wasPressed and wasReleased.
+    */
+    class InputState
+    {
+    public:
+        /** called at the start of every frame, before the events of the frame are applied */
+        void beginFrame();
+        void update(const Event &);
+        /** releases every key and button, applied by update for WindowEventType::FOCUS_LOST */
+        void reset();
+
+        bool isDown(const Key &) const;
+        bool wasDown(const Key &) const;
+        bool wasPressed(const Key &) const;
+        bool wasReleased(const Key &) const;
+
+        bool isDown(const Button &) const;
+        bool wasDown(const Button &) const;
+        bool wasPressed(const Button &) const;
+        bool wasReleased(const Button &) const;
+
+        Point getMousePosition() const;
+        /** summed relative mouse motion of the current frame */
+        Point getMouseMotion() const;
+        /** summed wheel motion of the current frame */
+        Point getWheelMotion() const;
+
+    private:
+        std::bitset<Keys::COUNT> currentKeys;
+        std::bitset<Keys::COUNT> previousKeys;
+        std::bitset<Keys::COUNT> pressedKeys;
+        std::bitset<Keys::COUNT> releasedKeys;
+
+        std::bitset<Buttons::COUNT> currentButtons;
+        std::bitset<Buttons::COUNT> previousButtons;
+        std::bitset<Buttons::COUNT> pressedButtons;
+        std::bitset<Buttons::COUNT> releasedButtons;
+
+        Point mousePosition = {0, 0};
+        Point mouseMotion = {0, 0};
+        Point wheelMotion = {0, 0};
+    };
+}
+
+#endif  // BKENGINE_INPUT_STATE_H
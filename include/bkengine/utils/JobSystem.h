@@ -0,0 +1,133 @@
+#ifndef BKENGINE_JOB_SYSTEM_H
+#define BKENGINE_JOB_SYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/WorkStealingQueue.h"
+
+
+namespace bkengine
+{
+    class JobCounter;
+    class JobSystem;
+
+    struct Job
+    {
+        std::function<void()> function;
+        JobCounter *counter;
+    };
+
+    /**
+        Counts the unfinished jobs which were submitted with it.
+        A counter can be used as dependency for other jobs (JobSystem::submitAfter) and
+        has to outlive all jobs referring to it, which is guaranteed after JobSystem::wait returns.
+    */
+    class JobCounter
+    {
+        friend class JobSystem;
+
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter &) = delete;
+        JobCounter &operator=(const JobCounter &) = delete;
+
+        bool isDone() const;
+        uint32_t getCount() const;
+
+    private:
+        std::atomic<uint32_t> count{0};
+
+        std::mutex mutex;
+        std::vector<Job *> continuations;
+        std::exception_ptr exception;
+    };
+
+    /**
+        Work-stealing thread pool.
+        Every worker owns a Chase-Lev deque, jobs submitted from outside of the pool are put
+        into a shared injection queue. Idle workers and threads blocked in wait() steal jobs
+        from the other workers. Background jobs have a queue of their own which idle workers
+        drain. With zero workers every job is executed inline.
+
+        Exceptions thrown by a job are rethrown by wait() on its counter. Jobs without a counter
+        must not throw.
+
+        A job may drop the last reference to the system. Its worker is detached instead of joined
+        and exits as soon as the job returns.
+    */
+    class JobSystem
+    {
+    public:
+        explicit JobSystem(uint32_t workerCount);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        static uint32_t getDefaultWorkerCount();
+        uint32_t getWorkerCount() const;
+        bool isWorkerThread() const;
+
+        void submit(const std::function<void()> &job, JobCounter *counter = nullptr);
+        /**
+            Submits a long-running job, e.g. an asset load, which must not delay the thread waiting
+            for other jobs. Background jobs are taken by idle workers, wait() only runs the ones
+            submitted with the counter it waits on.
+        */
+        void submitBackground(const std::function<void()> &job, JobCounter *counter = nullptr);
+        void submitAfter(JobCounter &dependency, const std::function<void()> &job, JobCounter *counter = nullptr);
+        void wait(JobCounter &counter);
+
+        /**
+            Splits [begin, end) into chunks of grainSize indices and calls function(first, last)
+            for every chunk, one of them on the calling thread. Returns after all chunks are done.
+            A grainSize of 0 picks a chunk size based on the number of workers.
+        */
+        template <typename Function>
+        void parallelFor(size_t begin, size_t end, size_t grainSize, Function &&function);
+
+    private:
+        struct Worker
+        {
+            WorkStealingQueue queue;
+            std::thread thread;
+        };
+
+        void start();
+        void workerLoop(uint32_t index);
+
+        void push(Job *job, bool background = false);
+        Job *findJob(const JobCounter *waitedCounter);
+        Job *takeFromQueue(std::deque<Job *> &queue, const JobCounter *counter = nullptr);
+        void execute(Job *job);
+        void finish(JobCounter *counter, std::exception_ptr exception);
+
+        uint32_t workerCount;
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::once_flag startFlag;
+        std::atomic<bool> stopping{false};
+
+        std::mutex injectionMutex;
+        std::deque<Job *> injectionQueue;
+        std::deque<Job *> backgroundQueue;
+
+        std::atomic<int64_t> pendingJobs{0};
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+    };
+}
+
+#include "templates/JobSystem_templates.h"
+
+#endif  // BKENGINE_JOB_SYSTEM_H
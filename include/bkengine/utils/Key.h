@@ -1,6 +1,7 @@
 #ifndef BKENGINE_KEY_H
 #define BKENGINE_KEY_H
 
+#include <cstdint>
 #include <string>
 
 
@@ -11,10 +12,24 @@ namespace bkengine
         friend class Keys;
 
     public:
-        explicit Key();
+        constexpr Key() : code(0)
+        {
+        }
 
-        bool operator==(const Key &key) const;
-        bool operator!=(const Key &key) const;
+        constexpr bool operator==(const Key &key) const
+        {
+            return code == key.code;
+        }
+
+        constexpr bool operator!=(const Key &key) const
+        {
+            return code != key.code;
+        }
+
+        constexpr uint16_t getCode() const
+        {
+            return code;
+        }
 
         operator const std::string() const;
         operator const char *() const;
@@ -22,9 +37,11 @@ namespace bkengine
         std::string toString() const;
 
     private:
-        explicit Key(const std::string &keyString);
+        explicit constexpr Key(uint16_t code) : code(code)
+        {
+        }
 
-        std::string keyString;
+        uint16_t code;
     };
 
     class Button
@@ -32,10 +49,24 @@ namespace bkengine
         friend class Buttons;
 
     public:
-        explicit Button();
+        constexpr Button() : code(0)
+        {
+        }
+
+        constexpr bool operator==(const Button &button) const
+        {
+            return code == button.code;
+        }
+
+        constexpr bool operator!=(const Button &button) const
+        {
+            return code != button.code;
+        }
 
-        bool operator==(const Button &button) const;
-        bool operator!=(const Button &button) const;
+        constexpr uint16_t getCode() const
+        {
+            return code;
+        }
 
         operator const std::string() const;
         operator const char *() const;
@@ -43,10 +74,12 @@ namespace bkengine
         std::string toString() const;
 
     private:
-        explicit Button(const std::string &buttonString);
+        explicit constexpr Button(uint16_t code) : code(code)
+        {
+        }
 
-        std::string buttonString;
+        uint16_t code;
     };
 }
 
-#endif  // BKENGINE_KEY_H
\ No newline at end of file
+#endif  // BKENGINE_KEY_H
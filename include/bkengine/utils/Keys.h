@@ -1,155 +1,166 @@
 #ifndef BKENGINE_KEYS_H
 #define BKENGINE_KEYS_H
 
+#include <cstdint>
+
 #include "utils/Key.h"
 
 
 namespace bkengine
 {
+    /**
+        Key constants. Every key is a small integer code, its name is only looked up for debugging.
+    */
     class Keys
     {
     private:
         Keys() = delete;
 
     public:
-        static Key UNKNOWN;
+        static const uint16_t COUNT = 119;
+
+        static const char *getName(const Key &);
+        /** UNKNOWN for codes out of range */
+        static Key fromCode(uint16_t);
+
+        static constexpr Key UNKNOWN{0};
 
         /* Control Key */
-        static Key RETURN;
-        static Key ESCAPE;
-        static Key BACKSPACE;
-        static Key TAB;
-        static Key SPACE;
-        static Key CAPSLOCK;
+        static constexpr Key RETURN{1};
+        static constexpr Key ESCAPE{2};
+        static constexpr Key BACKSPACE{3};
+        static constexpr Key TAB{4};
+        static constexpr Key SPACE{5};
+        static constexpr Key CAPSLOCK{6};
 
         /* Number Key */
-        static Key ZERO;
-        static Key ONE;
-        static Key TWO;
-        static Key THREE;
-        static Key FOUR;
-        static Key FIVE;
-        static Key SIX;
-        static Key SEVEN;
-        static Key EIGHT;
-        static Key NINE;
+        static constexpr Key ZERO{7};
+        static constexpr Key ONE{8};
+        static constexpr Key TWO{9};
+        static constexpr Key THREE{10};
+        static constexpr Key FOUR{11};
+        static constexpr Key FIVE{12};
+        static constexpr Key SIX{13};
+        static constexpr Key SEVEN{14};
+        static constexpr Key EIGHT{15};
+        static constexpr Key NINE{16};
 
         /* Letter Key */
-        static Key A;
-        static Key B;
-        static Key C;
-        static Key D;
-        static Key E;
-        static Key F;
-        static Key G;
-        static Key H;
-        static Key I;
-        static Key J;
-        static Key K;
-        static Key L;
-        static Key M;
-        static Key N;
-        static Key O;
-        static Key P;
-        static Key Q;
-        static Key R;
-        static Key S;
-        static Key T;
-        static Key U;
-        static Key V;
-        static Key W;
-        static Key X;
-        static Key Y;
-        static Key Z;
+        static constexpr Key A{17};
+        static constexpr Key B{18};
+        static constexpr Key C{19};
+        static constexpr Key D{20};
+        static constexpr Key E{21};
+        static constexpr Key F{22};
+        static constexpr Key G{23};
+        static constexpr Key H{24};
+        static constexpr Key I{25};
+        static constexpr Key J{26};
+        static constexpr Key K{27};
+        static constexpr Key L{28};
+        static constexpr Key M{29};
+        static constexpr Key N{30};
+        static constexpr Key O{31};
+        static constexpr Key P{32};
+        static constexpr Key Q{33};
+        static constexpr Key R{34};
+        static constexpr Key S{35};
+        static constexpr Key T{36};
+        static constexpr Key U{37};
+        static constexpr Key V{38};
+        static constexpr Key W{39};
+        static constexpr Key X{40};
+        static constexpr Key Y{41};
+        static constexpr Key Z{42};
 
         /* Function Key */
-        static Key F1;
-        static Key F2;
-        static Key F3;
-        static Key F4;
-        static Key F5;
-        static Key F6;
-        static Key F7;
-        static Key F8;
-        static Key F9;
-        static Key F10;
-        static Key F11;
-        static Key F12;
-        static Key F13;
-        static Key F14;
-        static Key F15;
-        static Key F16;
-        static Key F17;
-        static Key F18;
-        static Key F19;
-        static Key F20;
-        static Key F21;
-        static Key F22;
-        static Key F23;
-        static Key F24;
+        static constexpr Key F1{43};
+        static constexpr Key F2{44};
+        static constexpr Key F3{45};
+        static constexpr Key F4{46};
+        static constexpr Key F5{47};
+        static constexpr Key F6{48};
+        static constexpr Key F7{49};
+        static constexpr Key F8{50};
+        static constexpr Key F9{51};
+        static constexpr Key F10{52};
+        static constexpr Key F11{53};
+        static constexpr Key F12{54};
+        static constexpr Key F13{55};
+        static constexpr Key F14{56};
+        static constexpr Key F15{57};
+        static constexpr Key F16{58};
+        static constexpr Key F17{59};
+        static constexpr Key F18{60};
+        static constexpr Key F19{61};
+        static constexpr Key F20{62};
+        static constexpr Key F21{63};
+        static constexpr Key F22{64};
+        static constexpr Key F23{65};
+        static constexpr Key F24{66};
 
         /* Arrow Key */
-        static Key RIGHT;
-        static Key LEFT;
-        static Key DOWN;
-        static Key UP;
-
-        static Key PRINTSCREEN;
-        static Key SCROLLLOCK;
-        static Key PAUSE;
-        static Key INSERT;
-        static Key HOME;
-        static Key PAGEUP;
-        static Key DELETE;
-        static Key END;
-        static Key PAGEDOWN;
+        static constexpr Key RIGHT{67};
+        static constexpr Key LEFT{68};
+        static constexpr Key DOWN{69};
+        static constexpr Key UP{70};
+
+        static constexpr Key PRINTSCREEN{71};
+        static constexpr Key SCROLLLOCK{72};
+        static constexpr Key PAUSE{73};
+        static constexpr Key INSERT{74};
+        static constexpr Key HOME{75};
+        static constexpr Key PAGEUP{76};
+        static constexpr Key DELETE{77};
+        static constexpr Key END{78};
+        static constexpr Key PAGEDOWN{79};
 
         /* Numpad Key */
-        static Key NUMLOCKCLEAR;
-        static Key NP_DIVIDE;
-        static Key NP_MULTIPLY;
-        static Key NP_MINUS;
-        static Key NP_PLUS;
-        static Key NP_ENTER;
-        static Key NP_ONE;
-        static Key NP_TWO;
-        static Key NP_THREE;
-        static Key NP_FOUR;
-        static Key NP_FIVE;
-        static Key NP_SIX;
-        static Key NP_SEVEN;
-        static Key NP_EIGHT;
-        static Key NP_NINE;
-        static Key NP_ZERO;
-        static Key NP_SEPARATOR;
+        static constexpr Key NUMLOCKCLEAR{80};
+        static constexpr Key NP_DIVIDE{81};
+        static constexpr Key NP_MULTIPLY{82};
+        static constexpr Key NP_MINUS{83};
+        static constexpr Key NP_PLUS{84};
+        static constexpr Key NP_ENTER{85};
+        static constexpr Key NP_ONE{86};
+        static constexpr Key NP_TWO{87};
+        static constexpr Key NP_THREE{88};
+        static constexpr Key NP_FOUR{89};
+        static constexpr Key NP_FIVE{90};
+        static constexpr Key NP_SIX{91};
+        static constexpr Key NP_SEVEN{92};
+        static constexpr Key NP_EIGHT{93};
+        static constexpr Key NP_NINE{94};
+        static constexpr Key NP_ZERO{95};
+        static constexpr Key NP_SEPARATOR{96};
 
         /* Modifier Key */
-        static Key LCTRL;
-        static Key LSHIFT;
-        static Key LALT;
-        static Key LGUI;
-        static Key RCTRL;
-        static Key RSHIFT;
-        static Key RALT;
-        static Key RGUI;
+        static constexpr Key LCTRL{97};
+        static constexpr Key LSHIFT{98};
+        static constexpr Key LALT{99};
+        static constexpr Key LGUI{100};
+        static constexpr Key RCTRL{101};
+        static constexpr Key RSHIFT{102};
+        static constexpr Key RALT{103};
+        static constexpr Key RGUI{104};
 
         /* Media Key */
-        static Key MUTE;
-        static Key VOLUMEUP;
-        static Key VOLUMEDOWN;
-        static Key AUDIONEXT;
-        static Key AUDIOPREV;
-        static Key AUDIOSTOP;
-        static Key AUDIOPLAY;
-        static Key AUDIOMUTE;
+        static constexpr Key MUTE{105};
+        static constexpr Key VOLUMEUP{106};
+        static constexpr Key VOLUMEDOWN{107};
+        static constexpr Key AUDIONEXT{108};
+        static constexpr Key AUDIOPREV{109};
+        static constexpr Key AUDIOSTOP{110};
+        static constexpr Key AUDIOPLAY{111};
+        static constexpr Key AUDIOMUTE{112};
 
         /* Special Key */
-        static Key APPLICATION;
-        static Key MENU;
-        static Key BRIGHTNESSDOWN;
-        static Key BRIGHTNESSUP;
-        static Key SLEEP;
-        static Key POWER;
+        static constexpr Key APPLICATION{113};
+        static constexpr Key MENU{114};
+        static constexpr Key BRIGHTNESSDOWN{115};
+        static constexpr Key BRIGHTNESSUP{116};
+        static constexpr Key SLEEP{117};
+        static constexpr Key POWER{118};
     };
 
     class Buttons
@@ -158,11 +169,17 @@ namespace bkengine
         Buttons() = delete;
 
     public:
-        static Button UNKNOWN;
-        static Button LEFT;
-        static Button RIGHT;
-        static Button MIDDLE;
-        static Button SPECIAL;
+        static const uint16_t COUNT = 5;
+
+        static const char *getName(const Button &);
+        /** UNKNOWN for codes out of range */
+        static Button fromCode(uint16_t);
+
+        static constexpr Button UNKNOWN{0};
+        static constexpr Button LEFT{1};
+        static constexpr Button RIGHT{2};
+        static constexpr Button MIDDLE{3};
+        static constexpr Button SPECIAL{4};
     };
 }
 
@@ -1,6 +1,8 @@
 #ifndef BKENGINE_LOGGER_H
 #define BKENGINE_LOGGER_H
 
+#include <atomic>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
@@ -30,14 +32,15 @@ namespace bkengine
     class Logger : public std::ostream
     {
     private:
-        class LoggerStreamBuf : public std::stringbuf
+        /** collects the message of every thread separately until the logger is flushed */
+        class LoggerStreamBuf : public std::streambuf
         {
-            std::ostream &output;
-            std::string prefix;
             Logger *logger;
 
+            std::string &GetMessage();
+
         public:
-            LoggerStreamBuf() : output(std::cout), prefix(""), logger(nullptr)
+            LoggerStreamBuf() : logger(nullptr)
             {
             }
 
@@ -46,23 +49,23 @@ namespace bkengine
                 this->logger = logger;
             }
 
-            void SetPrefix(const std::string &newPrefix)
-            {
-                prefix = newPrefix;
-            }
-
+            int overflow(int character) override;
+            std::streamsize xsputn(const char *characters, std::streamsize count) override;
             int sync() override;
         };
 
+        class AsyncBackend;
+
         struct StaticConstructor
         {
             StaticConstructor();
         };
         static StaticConstructor _;
 
-        static bool useColors;
+        static std::atomic<bool> useColors;
         static std::mutex loggerMutex;
         static int logLevel;
+        static std::ostream *output;
 
         LogLevel level;
         LoggerStreamBuf buffer;
@@ -78,6 +81,21 @@ namespace bkengine
         static void UnsetLevel(LogLevel level);
         static bool IsSet(LogLevel level);
         static void UseColors(bool colors);
+        /** the stream all loggers write to, std::cout by default */
+        static void SetOutput(std::ostream &stream);
+
+        /**
+            In async mode a flushed message is only copied to a lock-free buffer of the calling thread,
+            a background thread formats and writes the messages of all threads in batches.
+            Messages are dropped instead of blocking when the buffer of a thread is full.
+            Async mode ends at exit, messages logged afterwards are written synchronously.
+        */
+        static void UseAsync(bool async);
+        static bool IsAsync();
+        /** blocks until every message flushed so far has been written */
+        static void Flush();
+        /** number of messages dropped by async mode because of full buffers */
+        static uint64_t GetDroppedCount();
 
         static Logger fatal;
         static Logger error;
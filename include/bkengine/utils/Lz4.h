@@ -0,0 +1,39 @@
+#ifndef BKENGINE_LZ4_H
+#define BKENGINE_LZ4_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace bkengine
+{
+    /**
+        Compressor and decompressor for the LZ4 block format.
+        The compressor is a plain greedy implementation, its output can be decoded by any
+        LZ4 block decoder.
+    */
+    class Lz4
+    {
+    public:
+        static size_t getMaxCompressedSize(size_t size);
+        /**
+            Upper bound of the size a block of compressedSize bytes can decompress to.
+        */
+        static uint64_t getMaxDecompressedSize(uint64_t compressedSize);
+
+        /**
+            Returns the compressed size. The destination has to hold getMaxCompressedSize(size) bytes.
+        */
+        static size_t compress(const uint8_t *source, size_t size, uint8_t *destination);
+
+        /**
+            Returns false if the block is malformed or does not decompress to exactly size bytes.
+        */
+        static bool decompress(const uint8_t *source, size_t compressedSize, uint8_t *destination, size_t size);
+
+    private:
+        Lz4() = delete;
+    };
+}
+
+#endif  // BKENGINE_LZ4_H
@@ -0,0 +1,117 @@
+#ifndef BKENGINE_MEMORY_RESOURCE_H
+#define BKENGINE_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+
+namespace bkengine
+{
+    /**
+        Source of memory for ResourceAllocator, modeled after std::pmr::memory_resource.
+    */
+    class MemoryResource
+    {
+    public:
+        virtual ~MemoryResource() = default;
+
+        void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+        void deallocate(void *pointer, size_t bytes, size_t alignment = alignof(std::max_align_t));
+        bool isEqual(const MemoryResource &other) const noexcept;
+
+    protected:
+        virtual void *doAllocate(size_t bytes, size_t alignment) = 0;
+        virtual void doDeallocate(void *pointer, size_t bytes, size_t alignment) = 0;
+        virtual bool doIsEqual(const MemoryResource &other) const noexcept;
+    };
+
+    /**
+        Memory resource using global operator new and delete. Never destroyed.
+    */
+    std::shared_ptr<MemoryResource> getDefaultMemoryResource();
+
+    /**
+        Arena which hands out memory from chunks requested from an upstream resource.
+        Deallocation is a no-op, all chunks are returned at once by release() or on destruction.
+        Each chunk is twice as large as the previous one. Allocation is thread-safe.
+    */
+    class MonotonicBufferResource : public MemoryResource
+    {
+    public:
+        explicit MonotonicBufferResource(size_t initialSize = 64 * 1024,
+                                         const std::shared_ptr<MemoryResource> &upstream = getDefaultMemoryResource());
+        ~MonotonicBufferResource();
+
+        MonotonicBufferResource(const MonotonicBufferResource &) = delete;
+        MonotonicBufferResource &operator=(const MonotonicBufferResource &) = delete;
+
+        void release();
+
+        size_t getAllocatedBytes() const;
+        size_t getChunkCount() const;
+
+    protected:
+        void *doAllocate(size_t bytes, size_t alignment) override;
+        void doDeallocate(void *pointer, size_t bytes, size_t alignment) override;
+
+    private:
+        struct Chunk
+        {
+            void *memory;
+            size_t size;
+        };
+
+        void addChunk(size_t minimumSize);
+
+        std::shared_ptr<MemoryResource> upstream;
+        size_t nextChunkSize;
+
+        mutable std::mutex mutex;
+        std::vector<Chunk> chunks;
+        char *current = nullptr;
+        size_t remaining = 0;
+        size_t allocatedBytes = 0;
+    };
+
+    /**
+        Allocator drawing memory from a MemoryResource, modeled after std::pmr::polymorphic_allocator.
+        The allocator shares ownership of its resource, so objects created through
+        std::allocate_shared keep their arena alive.
+    */
+    template <typename T>
+    class ResourceAllocator
+    {
+        template <typename U>
+        friend class ResourceAllocator;
+
+    public:
+        typedef T value_type;
+
+        ResourceAllocator() noexcept;
+        // cppcheck-suppress noExplicitConstructor
+        ResourceAllocator(const std::shared_ptr<MemoryResource> &resource) noexcept;
+        template <typename U>
+        ResourceAllocator(const ResourceAllocator<U> &other) noexcept;
+
+        T *allocate(size_t count);
+        void deallocate(T *pointer, size_t count) noexcept;
+
+        std::shared_ptr<MemoryResource> getResource() const;
+
+    private:
+        std::shared_ptr<MemoryResource> resource;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const ResourceAllocator<T> &, const ResourceAllocator<U> &) noexcept;
+    template <typename T, typename U>
+    bool operator!=(const ResourceAllocator<T> &, const ResourceAllocator<U> &) noexcept;
+}
+
+#include "templates/MemoryResource_templates.h"
+
+#endif  // BKENGINE_MEMORY_RESOURCE_H
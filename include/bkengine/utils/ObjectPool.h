@@ -0,0 +1,92 @@
+#ifndef BKENGINE_OBJECT_POOL_H
+#define BKENGINE_OBJECT_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+
+namespace bkengine
+{
+    /**
+        Thread-safe pool of fixed-size memory blocks.
+        Memory is requested from the system in chunks of blocksPerChunk blocks. Freed blocks are
+        kept in a free list and handed out again, chunks are only released with the pool.
+    */
+    class ObjectPool
+    {
+    public:
+        ObjectPool(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk = 64);
+        ~ObjectPool();
+
+        ObjectPool(const ObjectPool &) = delete;
+        ObjectPool &operator=(const ObjectPool &) = delete;
+
+        void *allocate();
+        void deallocate(void *block);
+        void reserve(size_t blockCount);
+
+        size_t getBlockSize() const;
+        size_t getCapacity() const;
+        size_t getFreeCount() const;
+
+        /**
+            Pool shared by all types with the given size and alignment.
+            Shared pools are never destroyed, so objects may outlive static destruction.
+        */
+        template <size_t Size, size_t Alignment>
+        static ObjectPool &getSharedPool();
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        void addChunk();
+
+        size_t blockSize;
+        size_t blocksPerChunk;
+
+        mutable std::mutex mutex;
+        FreeBlock *freeList = nullptr;
+        size_t capacity = 0;
+        size_t freeCount = 0;
+        std::vector<void *> chunks;
+    };
+
+    /**
+        Allocator which takes single objects from the shared ObjectPool of their size.
+        Meant to be used with std::allocate_shared, which rebinds it to the type holding
+        both the object and its control block:
+
+            auto texture = std::allocate_shared<MyTexture>(PoolAllocator<MyTexture>());
+    */
+    template <typename T>
+    class PoolAllocator
+    {
+    public:
+        typedef T value_type;
+
+        PoolAllocator() noexcept = default;
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U> &) noexcept;
+
+        T *allocate(size_t count);
+        void deallocate(T *pointer, size_t count) noexcept;
+
+        static ObjectPool &getPool();
+    };
+
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept;
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept;
+}
+
+#include "templates/ObjectPool_templates.h"
+
+#endif  // BKENGINE_OBJECT_POOL_H
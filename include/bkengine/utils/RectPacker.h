@@ -0,0 +1,52 @@
+#ifndef BKENGINE_RECT_PACKER_H
+#define BKENGINE_RECT_PACKER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "utils/Geometry.h"
+
+
+namespace bkengine
+{
+    /**
+        Packs rectangles into a fixed area using the skyline bottom-left heuristic.
+        Every placed rectangle keeps the given padding to its right and bottom neighbours.
+    */
+    class RectPacker
+    {
+    public:
+        RectPacker(uint32_t width, uint32_t height, uint32_t padding = 0);
+
+        /**
+            Returns false if the rectangle does not fit into the remaining space.
+        */
+        bool insert(uint32_t width, uint32_t height, AbsRect &placement);
+        void reset();
+
+        uint32_t getWidth() const;
+        uint32_t getHeight() const;
+        /** fraction of the area covered by placed rectangles */
+        double getOccupancy() const;
+
+    private:
+        struct SkylineNode
+        {
+            uint32_t x;
+            uint32_t y;
+            uint32_t width;
+        };
+
+        bool fits(size_t index, uint32_t width, uint32_t height, uint32_t &y) const;
+        void addLevel(size_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+        uint32_t width;
+        uint32_t height;
+        uint32_t padding;
+
+        std::vector<SkylineNode> skyline;
+        uint64_t usedArea = 0;
+    };
+}
+
+#endif  // BKENGINE_RECT_PACKER_H
@@ -0,0 +1,41 @@
+#ifndef BKENGINE_SPATIAL_GRID_H
+#define BKENGINE_SPATIAL_GRID_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/Geometry.h"
+
+
+namespace bkengine
+{
+    /**
+        Uniform grid of square cells mapping rectangles to the cells they overlap.
+        Queries return the ids of all rectangles sharing a cell with the point, which still
+        have to be tested exactly.
+    */
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(double cellSize = 64);
+
+        void insert(uint32_t id, const AbsRect &rect);
+        void clear();
+
+        /** appends the candidates in ascending order of their ids */
+        void query(const Point &point, std::vector<uint32_t> &ids) const;
+
+        double getCellSize() const;
+        /** number of cells overlapped by at least one rectangle */
+        size_t getCellCount() const;
+
+    private:
+        static uint64_t getCellKey(int32_t x, int32_t y);
+
+        double cellSize;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    };
+}
+
+#endif  // BKENGINE_SPATIAL_GRID_H
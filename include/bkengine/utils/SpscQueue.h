@@ -0,0 +1,61 @@
+#ifndef BKENGINE_SPSC_QUEUE_H
+#define BKENGINE_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+namespace bkengine
+{
+    /**
+        Fixed capacity, lock-free ring buffer for exactly one producer and one consumer thread.
+        The capacity has to be a power of two. Elements are copied in and out, so T should be
+        small and trivially copyable.
+    */
+    template <typename T>
+    class SpscQueue
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "queued values are copied between threads");
+
+    public:
+        explicit SpscQueue(size_t capacity = 1024);
+
+        SpscQueue(const SpscQueue &) = delete;
+        SpscQueue &operator=(const SpscQueue &) = delete;
+
+        /** producer only, returns false if the queue is full */
+        bool push(const T &value);
+        /** producer only, returns the number of values pushed */
+        size_t push(const T *values, size_t count);
+
+        /** consumer only, returns false if the queue is empty */
+        bool pop(T &value);
+        /** consumer only, pops up to count values with a single synchronization */
+        size_t pop(T *values, size_t count);
+
+        /** exact for the producer and the consumer, approximate for other threads */
+        size_t size() const;
+        bool empty() const;
+        size_t getCapacity() const;
+
+    private:
+        static const size_t CACHE_LINE_SIZE = 64;
+
+        size_t mask;
+        std::unique_ptr<T[]> buffer;
+
+        // head and tail live on separate cache lines, so producer and consumer do not share one
+        char headPadding[CACHE_LINE_SIZE];
+        std::atomic<size_t> head{0};
+        char tailPadding[CACHE_LINE_SIZE];
+        std::atomic<size_t> tail{0};
+    };
+}
+
+#include "templates/SpscQueue_templates.h"
+
+#endif  // BKENGINE_SPSC_QUEUE_H
@@ -0,0 +1,41 @@
+#ifndef BKENGINE_WORK_STEALING_QUEUE_H
+#define BKENGINE_WORK_STEALING_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+
+namespace bkengine
+{
+    struct Job;
+
+    /**
+        Fixed capacity Chase-Lev deque.
+        Only the owning worker may call push() and pop(), which operate on the bottom end.
+        Any thread may call steal(), which takes jobs from the top end.
+    */
+    class WorkStealingQueue
+    {
+    public:
+        explicit WorkStealingQueue(uint32_t capacity = 4096);
+
+        WorkStealingQueue(const WorkStealingQueue &) = delete;
+        WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+
+        bool push(Job *job);
+        Job *pop();
+        Job *steal();
+
+        bool empty() const;
+
+    private:
+        std::atomic<int64_t> top;
+        std::atomic<int64_t> bottom;
+
+        int64_t mask;
+        std::unique_ptr<std::atomic<Job *>[]> buffer;
+    };
+}
+
+#endif  // BKENGINE_WORK_STEALING_QUEUE_H
@@ -0,0 +1,38 @@
+namespace bkengine
+{
+    template <typename Function>
+    void JobSystem::parallelFor(size_t begin, size_t end, size_t grainSize, Function &&function)
+    {
+        if (begin >= end) {
+            return;
+        }
+
+        size_t count = end - begin;
+        if (grainSize == 0) {
+            grainSize = std::max<size_t>(1, count / ((workerCount + 1) * 4));
+        }
+
+        if (workerCount == 0 || count <= grainSize) {
+            function(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+        for (size_t first = begin + grainSize; first < end; first += grainSize) {
+            size_t last = std::min(first + grainSize, end);
+            submit([&function, first, last]() { function(first, last); }, &counter);
+        }
+
+        try {
+            function(begin, begin + grainSize);
+        } catch (...) {
+            try {
+                wait(counter);
+            } catch (...) {
+            }
+            throw;
+        }
+
+        wait(counter);
+    }
+}
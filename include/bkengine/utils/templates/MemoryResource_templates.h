@@ -0,0 +1,49 @@
+namespace bkengine
+{
+    template <typename T>
+    ResourceAllocator<T>::ResourceAllocator() noexcept : resource(getDefaultMemoryResource())
+    {
+    }
+
+    template <typename T>
+    ResourceAllocator<T>::ResourceAllocator(const std::shared_ptr<MemoryResource> &resource) noexcept
+        : resource(resource != nullptr ? resource : getDefaultMemoryResource())
+    {
+    }
+
+    template <typename T>
+    template <typename U>
+    ResourceAllocator<T>::ResourceAllocator(const ResourceAllocator<U> &other) noexcept : resource(other.resource)
+    {
+    }
+
+    template <typename T>
+    T *ResourceAllocator<T>::allocate(size_t count)
+    {
+        return static_cast<T *>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    template <typename T>
+    void ResourceAllocator<T>::deallocate(T *pointer, size_t count) noexcept
+    {
+        resource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    template <typename T>
+    std::shared_ptr<MemoryResource> ResourceAllocator<T>::getResource() const
+    {
+        return resource;
+    }
+
+    template <typename T, typename U>
+    bool operator==(const ResourceAllocator<T> &first, const ResourceAllocator<U> &second) noexcept
+    {
+        return first.getResource()->isEqual(*second.getResource());
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const ResourceAllocator<T> &first, const ResourceAllocator<U> &second) noexcept
+    {
+        return !(first == second);
+    }
+}
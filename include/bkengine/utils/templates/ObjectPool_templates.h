@@ -0,0 +1,55 @@
+namespace bkengine
+{
+    template <size_t Size, size_t Alignment>
+    ObjectPool &ObjectPool::getSharedPool()
+    {
+        static_assert(Alignment <= alignof(std::max_align_t), "over-aligned types cannot be pooled");
+
+        static ObjectPool *pool = new ObjectPool(Size, Alignment);
+        return *pool;
+    }
+
+
+    template <typename T>
+    template <typename U>
+    PoolAllocator<T>::PoolAllocator(const PoolAllocator<U> &) noexcept
+    {
+    }
+
+    template <typename T>
+    T *PoolAllocator<T>::allocate(size_t count)
+    {
+        if (count != 1) {
+            return static_cast<T *>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T *>(getPool().allocate());
+    }
+
+    template <typename T>
+    void PoolAllocator<T>::deallocate(T *pointer, size_t count) noexcept
+    {
+        if (count != 1) {
+            ::operator delete(pointer);
+            return;
+        }
+        getPool().deallocate(pointer);
+    }
+
+    template <typename T>
+    ObjectPool &PoolAllocator<T>::getPool()
+    {
+        return ObjectPool::getSharedPool<sizeof(T), alignof(T)>();
+    }
+
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept
+    {
+        return false;
+    }
+}
@@ -0,0 +1,68 @@
+namespace bkengine
+{
+    template <typename T>
+    SpscQueue<T>::SpscQueue(size_t capacity) : mask(capacity - 1), buffer(new T[capacity])
+    {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::push(const T &value)
+    {
+        return push(&value, 1) == 1;
+    }
+
+    template <typename T>
+    size_t SpscQueue<T>::push(const T *values, size_t count)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+
+        count = std::min(count, mask + 1 - (t - h));
+        for (size_t i = 0; i < count; ++i) {
+            buffer[(t + i) & mask] = values[i];
+        }
+
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::pop(T &value)
+    {
+        return pop(&value, 1) == 1;
+    }
+
+    template <typename T>
+    size_t SpscQueue<T>::pop(T *values, size_t count)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t t = tail.load(std::memory_order_acquire);
+
+        count = std::min(count, t - h);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = buffer[(h + i) & mask];
+        }
+
+        head.store(h + count, std::memory_order_release);
+        return count;
+    }
+
+    template <typename T>
+    size_t SpscQueue<T>::size() const
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    size_t SpscQueue<T>::getCapacity() const
+    {
+        return mask + 1;
+    }
+}
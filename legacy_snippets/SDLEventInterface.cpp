@@ -157,6 +157,7 @@ Event SDLEventInterface::poll()
     }
 
     Event e;
+    e.timestamp = Event::getTimestamp();
 
     switch (event.type) {
         case SDL_WINDOWEVENT: {
@@ -224,8 +225,8 @@ Event SDLEventInterface::poll()
                     break;
             }
 
-            windowEvent.data.push_back(event.window.data1);
-            windowEvent.data.push_back(event.window.data2);
+            windowEvent.data1 = event.window.data1;
+            windowEvent.data2 = event.window.data2;
             e.window = windowEvent;
             break;
         }
@@ -15,29 +15,73 @@ std::string Animation::getName() const
 
 uint32_t Animation::getFramesPerTexture() const
 {
-    return framesPerTexture;
+    // expressed in frames of the nominal 60 FPS frame rate
+    return static_cast<uint32_t>((frameDuration * 60 + 500000) / 1000000);
 }
 
+double Animation::getFrameDuration() const
+{
+    return frameDuration / 1000.;
+}
 
-void Animation::_onRender()
+uint32_t Animation::getCurrentFrame() const
 {
-    bool suppress = onRender();
-    if (suppress) {
-        return;
+    if (stateTable != nullptr) {
+        return stateTable->frameIndices[stateIndex];
     }
+    return currentTextureIndex;
+}
 
-    if (framesPerTexture == 0) {
+void Animation::skipFrames(uint32_t count)
+{
+    if (textures.empty()) {
         return;
     }
 
-    if (frameCounter < framesPerTexture - 1) {
-        frameCounter++;
+    uint32_t frame = static_cast<uint32_t>((getCurrentFrame() + count) % textures.size());
+    if (stateTable != nullptr) {
+        stateTable->frameIndices[stateIndex] = frame;
     } else {
-        frameCounter = 0;
-        currentTextureIndex = (currentTextureIndex + 1) % textures.size();
+        currentTextureIndex = frame;
+    }
+}
+
+
+void Animation::_onRender(uint64_t delta)
+{
+    if (renderHook) {
+        bool suppress = onRender();
+        if (suppress) {
+            return;
+        }
+    }
+
+    if (textures.empty()) {
+        return;
+    }
+
+    // animations of a scene are advanced in one batch by its AnimationStateTable
+    if (stateTable == nullptr) {
+        advance(delta);
     }
 
-    assert(currentTextureIndex < textures.size());
+    uint32_t frame = getCurrentFrame();
+    assert(frame < textures.size());
+
+    textures[frame]->onRender();
+}
 
-    textures[currentTextureIndex]->onRender();
+void Animation::advance(uint64_t delta)
+{
+    if (frameDuration == 0) {
+        return;
+    }
+
+    elapsedTime += delta;
+    if (elapsedTime >= frameDuration) {
+        // long frames skip several textures at once
+        uint64_t steps = elapsedTime / frameDuration;
+        elapsedTime %= frameDuration;
+        currentTextureIndex = static_cast<uint32_t>((currentTextureIndex + steps) % textures.size());
+    }
 }
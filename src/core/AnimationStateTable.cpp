@@ -0,0 +1,89 @@
+#include "core/AnimationStateTable.h"
+#include "core/Animation.h"
+#include "core/Element.h"
+
+using namespace bkengine;
+
+
+AnimationStateTable::~AnimationStateTable()
+{
+    clear();
+}
+
+void AnimationStateTable::markDirty()
+{
+    dirty = true;
+}
+
+bool AnimationStateTable::isDirty() const
+{
+    return dirty;
+}
+
+void AnimationStateTable::rebuild(const std::vector<std::shared_ptr<Element>> &elements)
+{
+    clear();
+
+    for (auto &element : elements) {
+        auto &animation = element->currentAnimation;
+        if (animation == nullptr || animation->textures.empty() || animation->stateTable == this) {
+            continue;
+        }
+
+        animation->stateTable = this;
+        animation->stateIndex = static_cast<uint32_t>(animations.size());
+
+        animations.push_back(animation);
+        frameIndices.push_back(animation->currentTextureIndex % animation->textures.size());
+        frameCounts.push_back(static_cast<uint32_t>(animation->textures.size()));
+        elapsedTimes.push_back(animation->elapsedTime);
+        frameDurations.push_back(animation->frameDuration);
+    }
+
+    dirty = false;
+}
+
+void AnimationStateTable::step(uint64_t delta)
+{
+    uint32_t *indices = frameIndices.data();
+    const uint32_t *counts = frameCounts.data();
+    uint64_t *elapsed = elapsedTimes.data();
+    const uint64_t *durations = frameDurations.data();
+    size_t count = animations.size();
+
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t time = elapsed[i] + delta;
+        uint64_t duration = durations[i];
+        uint64_t steps = duration > 0 ? time / duration : 0;
+
+        elapsed[i] = time - steps * duration;
+        indices[i] = static_cast<uint32_t>((indices[i] + steps) % counts[i]);
+    }
+}
+
+void AnimationStateTable::clear()
+{
+    // hand the playback state back to the animations
+    for (size_t i = 0; i < animations.size(); ++i) {
+        auto &animation = animations[i];
+        if (animation->stateTable != this) {
+            continue;
+        }
+
+        animation->currentTextureIndex = frameIndices[i];
+        animation->elapsedTime = elapsedTimes[i];
+        animation->stateTable = nullptr;
+    }
+
+    animations.clear();
+    frameIndices.clear();
+    frameCounts.clear();
+    elapsedTimes.clear();
+    frameDurations.clear();
+    dirty = true;
+}
+
+size_t AnimationStateTable::size() const
+{
+    return animations.size();
+}
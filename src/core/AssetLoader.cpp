@@ -0,0 +1,133 @@
+#include "core/AssetLoader.h"
+
+using namespace bkengine;
+
+
+AssetLoader::AssetLoader(const std::shared_ptr<JobSystem> &jobSystem) : jobSystem(jobSystem)
+{
+    assert(jobSystem != nullptr);
+}
+
+AssetLoader::~AssetLoader()
+{
+    cancel();
+}
+
+void AssetLoader::load(const std::shared_ptr<AsyncTexture> &texture, const Load &loader, int32_t priority)
+{
+    assert(texture != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.push({priority, nextSequence++, texture, loader});
+    }
+
+    // every job loads the request with the highest priority at the time it runs, loads are kept
+    // out of the frame by running them on idle workers only
+    jobSystem->submitBackground([this]() { loadNext(); }, &counter);
+}
+
+size_t AssetLoader::applyLoaded()
+{
+    std::vector<Result> finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.swap(results);
+    }
+
+    size_t applied = 0;
+    for (auto &result : finished) {
+        auto &asyncTexture = result.asyncTexture;
+        if (asyncTexture->state != LoadState::PENDING) {
+            continue;
+        }
+
+        std::shared_ptr<Texture> texture = nullptr;
+        if (result.error.empty()) {
+            try {
+                texture = result.upload();
+                if (texture == nullptr) {
+                    result.error = "no texture was created";
+                }
+            } catch (const std::exception &exception) {
+                result.error = exception.what();
+            }
+        }
+
+        if (texture == nullptr) {
+            asyncTexture->error = result.error;
+            asyncTexture->state = LoadState::FAILED;
+            Logger::error << "AssetLoader::applyLoaded(): loading texture '" << asyncTexture->name
+                          << "' failed: " << result.error;
+            continue;
+        }
+
+        asyncTexture->texture = texture;
+        asyncTexture->state = LoadState::LOADED;
+        applied++;
+    }
+    return applied;
+}
+
+void AssetLoader::finish()
+{
+    jobSystem->wait(counter);
+    applyLoaded();
+}
+
+void AssetLoader::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests = std::priority_queue<Request>();
+    }
+    jobSystem->wait(counter);
+}
+
+size_t AssetLoader::getPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return requests.size() + loading + results.size();
+}
+
+
+bool AssetLoader::Request::operator<(const Request &request) const
+{
+    // lower priority first, ties are loaded in submission order
+    return priority < request.priority || (priority == request.priority && sequence > request.sequence);
+}
+
+void AssetLoader::loadNext()
+{
+    Request request;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (requests.empty()) {
+            return;
+        }
+        request = requests.top();
+        requests.pop();
+        loading++;
+    }
+
+    auto asyncTexture = request.texture.lock();
+    if (asyncTexture == nullptr || asyncTexture->state != LoadState::PENDING) {
+        std::lock_guard<std::mutex> lock(mutex);
+        loading--;
+        return;
+    }
+
+    Result result = {asyncTexture, nullptr, ""};
+    try {
+        result.upload = request.loader();
+        if (!result.upload) {
+            result.error = "nothing was loaded";
+        }
+    } catch (const std::exception &exception) {
+        result.error = exception.what();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    results.push_back(std::move(result));
+    loading--;
+}
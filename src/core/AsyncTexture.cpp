@@ -0,0 +1,38 @@
+#include "core/AsyncTexture.h"
+
+using namespace bkengine;
+
+
+void AsyncTexture::onRender()
+{
+    auto current = getTexture();
+    if (current != nullptr) {
+        current->onRender();
+    }
+}
+
+LoadState AsyncTexture::getState() const
+{
+    return state;
+}
+
+bool AsyncTexture::isLoaded() const
+{
+    return state == LoadState::LOADED;
+}
+
+std::string AsyncTexture::getError() const
+{
+    return error;
+}
+
+void AsyncTexture::cancel()
+{
+    LoadState expected = LoadState::PENDING;
+    state.compare_exchange_strong(expected, LoadState::CANCELLED);
+}
+
+std::shared_ptr<Texture> AsyncTexture::getTexture() const
+{
+    return texture != nullptr ? texture : placeholder;
+}
@@ -1,4 +1,5 @@
 #include "core/Element.h"
+#include "core/Scene.h"
 
 using namespace bkengine;
 
@@ -34,8 +35,31 @@ RelRect Element::getCollisionBox() const
     return collisionBox;
 }
 
+std::shared_ptr<JobSystem> Element::getJobSystem() const
+{
+    auto scene = parentScene.lock();
+    if (scene == nullptr) {
+        return nullptr;
+    }
+    return scene->getJobSystem();
+}
+
+std::shared_ptr<MemoryResource> Element::getMemoryResource() const
+{
+    auto scene = parentScene.lock();
+    if (scene == nullptr) {
+        return nullptr;
+    }
+    return scene->getMemoryResource();
+}
+
+bool Element::isThreadSafe() const
+{
+    return threadSafe;
+}
+
 
-void Element::_onRender()
+void Element::_onRender(uint64_t delta)
 {
     bool suppress = onRender();
     if (suppress) {
@@ -43,7 +67,7 @@ void Element::_onRender()
     }
 
     if (currentAnimation != nullptr) {
-        currentAnimation->_onRender();
+        currentAnimation->_onRender(delta);
     }
 }
 
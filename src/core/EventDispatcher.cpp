@@ -0,0 +1,180 @@
+#include "core/EventDispatcher.h"
+#include "core/Element.h"
+#include "utils/CoordinateUtils.h"
+
+#include <algorithm>
+
+using namespace bkengine;
+
+
+const size_t EventDispatcher::EVENT_TYPE_COUNT;
+
+void EventDispatcher::markDirty()
+{
+    dirty = true;
+}
+
+bool EventDispatcher::isDirty() const
+{
+    return dirty;
+}
+
+void EventDispatcher::rebuild(const std::vector<std::shared_ptr<Element>> &elements)
+{
+    dirty = false;
+    geometryStale = true;
+
+    broadcast.clear();
+    for (auto &entries : typed) {
+        entries.clear();
+    }
+    keyed.clear();
+    subscriptionCount = 0;
+
+    for (size_t order = 0; order < elements.size(); ++order) {
+        auto element = elements[order].get();
+        if (element->subscribedToAll) {
+            broadcast.push_back({order, element, EventSubscription()});
+            continue;
+        }
+
+        for (auto &subscription : element->subscriptions) {
+            Entry entry = {order, element, subscription};
+            if (subscription.filterKey) {
+                keyed[subscription.key.getCode()].push_back(entry);
+            } else {
+                typed.at(static_cast<size_t>(subscription.type)).push_back(entry);
+            }
+            subscriptionCount++;
+        }
+    }
+}
+
+const std::vector<Element *> &EventDispatcher::getReceivers(const Event &event)
+{
+    updateCursor(event);
+
+    candidates.clear();
+    for (auto &entry : broadcast) {
+        candidates.push_back(&entry);
+    }
+    collect(typed.at(static_cast<size_t>(event.type)), event);
+    if (event.type == EventType::KEYBOARD) {
+        auto result = keyed.find(event.keyboard.key.getCode());
+        if (result != keyed.end()) {
+            collect(result->second, event);
+        }
+    }
+
+    receivers.clear();
+    for (auto entry : candidates) {
+        // elements with several matching subscriptions are only notified once
+        if (receivers.empty() || receivers.back() != entry->element) {
+            receivers.push_back(entry->element);
+        }
+    }
+    return receivers;
+}
+
+void EventDispatcher::invalidateGeometry()
+{
+    geometryStale = true;
+}
+
+const std::vector<Element *> &EventDispatcher::getHitReceivers(const Event &event,
+                                                               const std::vector<std::shared_ptr<Element>> &elements,
+                                                               const Size &windowSize)
+{
+    updateCursor(event);
+    if (geometryStale || windowSize != hitGridWindowSize) {
+        rebuildHitGrid(elements, windowSize);
+    }
+
+    hitCandidates.clear();
+    hitGrid.query(cursor, hitCandidates);
+
+    receivers.clear();
+    for (auto it = hitCandidates.crbegin(); it != hitCandidates.crend(); ++it) {
+        auto &box = hitBoxes[*it];
+        auto element = elements[*it].get();
+        if (cursor.x >= box.x && cursor.x < box.x + box.w && cursor.y >= box.y && cursor.y < box.y + box.h
+            && isInterested(*element, event)) {
+            receivers.push_back(element);
+        }
+    }
+    return receivers;
+}
+
+size_t EventDispatcher::getSubscriptionCount() const
+{
+    return subscriptionCount;
+}
+
+const SpatialGrid &EventDispatcher::getHitGrid() const
+{
+    return hitGrid;
+}
+
+bool EventDispatcher::isPointerEvent(const Event &event)
+{
+    return event.type == EventType::MOUSE || event.type == EventType::MOTION || event.type == EventType::WHEEL;
+}
+
+
+void EventDispatcher::collect(const std::vector<Entry> &entries, const Event &event)
+{
+    size_t middle = candidates.size();
+    for (auto &entry : entries) {
+        if (entry.subscription.matches(event, cursor)) {
+            candidates.push_back(&entry);
+        }
+    }
+
+    auto byOrder = [](const Entry *first, const Entry *second) { return first->order < second->order; };
+    std::inplace_merge(candidates.begin(), candidates.begin() + middle, candidates.end(), byOrder);
+}
+
+void EventDispatcher::updateCursor(const Event &event)
+{
+    if (event.type == EventType::MOUSE) {
+        cursor = {static_cast<double>(event.mouse.x), static_cast<double>(event.mouse.y)};
+    } else if (event.type == EventType::MOTION) {
+        cursor = {static_cast<double>(event.motion.x), static_cast<double>(event.motion.y)};
+    }
+}
+
+bool EventDispatcher::isInterested(const Element &element, const Event &event) const
+{
+    if (element.subscribedToAll) {
+        return true;
+    }
+
+    auto matches = [this, &event](const EventSubscription &subscription) {
+        return subscription.matches(event, cursor);
+    };
+    return std::any_of(element.subscriptions.cbegin(), element.subscriptions.cend(), matches);
+}
+
+void EventDispatcher::rebuildHitGrid(const std::vector<std::shared_ptr<Element>> &elements, const Size &windowSize)
+{
+    geometryStale = false;
+    hitGridWindowSize = windowSize;
+
+    hitGrid.clear();
+    hitBoxes.resize(elements.size());
+    Rect window(0, 0, windowSize.w, windowSize.h);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        auto &box = hitBoxes[i];
+        box = RelativeCoordinates::apply(elements[i]->renderBox, window);
+
+        // the cursor never leaves the window, so only the visible part of a box is added to the grid,
+        // the whole box is still used for the exact test
+        double left = std::max(box.x, 0.0);
+        double top = std::max(box.y, 0.0);
+        double right = std::min(box.x + box.w, window.w);
+        double bottom = std::min(box.y + box.h, window.h);
+        if (right > left && bottom > top) {
+            hitGrid.insert(i, {left, top, right - left, bottom - top});
+        }
+    }
+}
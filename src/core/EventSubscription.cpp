@@ -0,0 +1,46 @@
+#include "core/EventSubscription.h"
+
+using namespace bkengine;
+
+
+EventSubscription EventSubscription::forType(EventType type)
+{
+    EventSubscription subscription;
+    subscription.type = type;
+    return subscription;
+}
+
+EventSubscription EventSubscription::forKey(const Key &key)
+{
+    EventSubscription subscription;
+    subscription.type = EventType::KEYBOARD;
+    subscription.filterKey = true;
+    subscription.key = key;
+    return subscription;
+}
+
+EventSubscription EventSubscription::forRegion(EventType type, const AbsRect &region)
+{
+    EventSubscription subscription;
+    subscription.type = type;
+    subscription.filterRegion = true;
+    subscription.region = region;
+    return subscription;
+}
+
+bool EventSubscription::matches(const Event &event, const Point &cursor) const
+{
+    if (event.type != type) {
+        return false;
+    }
+
+    if (filterKey && (event.type != EventType::KEYBOARD || event.keyboard.key != key)) {
+        return false;
+    }
+
+    if (filterRegion) {
+        return cursor.x >= region.x && cursor.x < region.x + region.w && cursor.y >= region.y
+               && cursor.y < region.y + region.h;
+    }
+    return true;
+}
@@ -1,12 +1,94 @@
 #include "core/Game.h"
 
+#include <thread>
+
 using namespace bkengine;
 
 
 // FPS = 60
 static const double SCREEN_TICKS_PER_FRAME = 1000. / 60.;
+static const std::chrono::microseconds INPUT_POLL_INTERVAL(500);
+// headless runs advance by exactly one nominal frame, independent of their real speed
+static const uint64_t HEADLESS_FRAME_DELTA = static_cast<uint64_t>(SCREEN_TICKS_PER_FRAME * 1000.);
+
+
+namespace
+{
+    /**
+        Polls the event interface on its own thread and feeds the event queue of the game
+        until destroyed.
+    */
+    class InputThread
+    {
+    public:
+        InputThread(const std::shared_ptr<EventInterface> &eventInterface, SpscQueue<Event> &queue)
+            : thread(&InputThread::sample, this, eventInterface, std::ref(queue))
+        {
+        }
+
+        ~InputThread()
+        {
+            active = false;
+            thread.join();
+        }
+
+    private:
+        void sample(std::shared_ptr<EventInterface> eventInterface, SpscQueue<Event> &queue)
+        {
+            while (active) {
+                while (eventInterface->ready()) {
+                    Event event = eventInterface->poll();
+                    if (event.timestamp == 0) {
+                        event.timestamp = Event::getTimestamp();
+                    }
+
+                    while (!queue.push(event)) {
+                        if (!active) {
+                            return;
+                        }
+                        std::this_thread::yield();
+                    }
+                }
+                std::this_thread::sleep_for(INPUT_POLL_INTERVAL);
+            }
+        }
+
+        std::atomic<bool> active{true};
+        std::thread thread;
+    };
+
+    /** flushes the recorded events when Game::run is left, also by an exception */
+    class RecorderFlush
+    {
+    public:
+        explicit RecorderFlush(const std::shared_ptr<EventRecorder> &recorder) : recorder(recorder)
+        {
+        }
+
+        ~RecorderFlush()
+        {
+            if (recorder != nullptr) {
+                try {
+                    recorder->flush();
+                } catch (const EventLogException &exception) {
+                    Logger::error << "Game::run(): " << exception.what();
+                }
+            }
+        }
+
+    private:
+        std::shared_ptr<EventRecorder> recorder;
+    };
+}
 
 
+Game::~Game()
+{
+    if (assetLoader != nullptr) {
+        assetLoader->cancel();
+    }
+}
+
 void Game::run()
 {
     auto eventInterface = interfaceContainer.getEventInterface();
@@ -25,33 +107,77 @@ void Game::run()
         throw GameLoopException("Game cannot be started because no settings interface is set!");
     }
 
-    Timer timer;
     running = true;
+    frameDelta = 0;
+    frameIndex = 0;
+    auto lastFrame = std::chrono::steady_clock::now();
+
+    RecorderFlush recorderFlush(eventRecorder);
+    std::unique_ptr<InputThread> inputThread = nullptr;
+    if (eventQueue != nullptr) {
+        inputThread.reset(new InputThread(eventInterface, *eventQueue));
+    }
 
     while (running) {
         timer.start();
 
-        while (eventInterface->ready()) {
-            Event event = eventInterface->poll();
+        auto frameStart = std::chrono::steady_clock::now();
+        frameDelta = headless
+                         ? HEADLESS_FRAME_DELTA
+                         : std::chrono::duration_cast<std::chrono::microseconds>(frameStart - lastFrame).count();
+        lastFrame = frameStart;
 
-            if (event.type == EventType::QUIT) {
-                running = false;
-                Logger::debug << "Game::run(): event has type EventType::QUIT";
+        // textures finished in the background are swapped in between frames
+        if (assetLoader != nullptr) {
+            assetLoader->applyLoaded();
+        }
+
+        inputState.beginFrame();
+        if (eventQueue != nullptr) {
+            // only the events queued before the frame started, in batches
+            size_t pending = eventQueue->size();
+            while (pending > 0) {
+                size_t count = eventQueue->pop(eventBuffer.data(), std::min(pending, eventBuffer.size()));
+                for (size_t i = 0; i < count; ++i) {
+                    receiveEvent(eventBuffer[i]);
+                }
+                pending -= count;
             }
+        } else {
+            eventInterface->beginFrame(frameIndex);
+            while (eventInterface->ready()) {
+                receiveEvent(eventInterface->poll());
+            }
+        }
 
-            _onEvent(event);
+        Event completed;
+        if (eventCoalescer.flush(completed)) {
+            processEvent(completed);
+        }
+
+        // the events of every finished frame are on disk, even if the next one crashes
+        if (eventRecorder != nullptr) {
+            eventRecorder->flush();
         }
 
         _onLoop();
-        _onRender();
+        if (renderInterval != 0 && frameIndex % renderInterval == 0) {
+            _onRender();
+        }
 
         uint64_t frameTicks = timer.getTicks();
 
-        if (frameTicks < SCREEN_TICKS_PER_FRAME) {
+        if (!headless && frameTicks < SCREEN_TICKS_PER_FRAME) {
             graphicsInterface->delay(SCREEN_TICKS_PER_FRAME - frameTicks);
         }
 
         timer.stop();
+        ++frameIndex;
+
+        if (maxFrames != 0 && frameIndex >= maxFrames) {
+            running = false;
+            Logger::debug << "Game::run(): reached the maximum of " << maxFrames << " frames";
+        }
     }
 }
 
@@ -65,6 +191,46 @@ bool Game::isRunning() const
     return running;
 }
 
+std::shared_ptr<JobSystem> Game::getJobSystem() const
+{
+    return jobSystem;
+}
+
+std::shared_ptr<AssetLoader> Game::getAssetLoader() const
+{
+    return assetLoader;
+}
+
+double Game::getFrameDelta() const
+{
+    return frameDelta / 1000.;
+}
+
+Size Game::getWindowSize() const
+{
+    return windowSize;
+}
+
+const InputState &Game::getInputState() const
+{
+    return inputState;
+}
+
+uint64_t Game::getFrameIndex() const
+{
+    return frameIndex;
+}
+
+bool Game::isHeadless() const
+{
+    return headless;
+}
+
+std::shared_ptr<EventRecorder> Game::getEventRecorder() const
+{
+    return eventRecorder;
+}
+
 bool Game::onRender()
 {
     return false;
@@ -97,6 +263,7 @@ void Game::setWindowSize(Size size)
         throw NullPointerException("Failed to set window size. Graphics interface is not set!");
     }
     graphicsInterface->setWindowSize(size);
+    windowSize = size;
 }
 
 void Game::setWindowTitle(const std::string &title)
@@ -109,6 +276,35 @@ void Game::setWindowTitle(const std::string &title)
 }
 
 
+void Game::receiveEvent(const Event &event)
+{
+    if (eventRecorder != nullptr) {
+        eventRecorder->record(frameIndex, event);
+    }
+
+    if (!eventCoalescer.isEnabled()) {
+        processEvent(event);
+        return;
+    }
+
+    Event completed;
+    if (eventCoalescer.add(event, completed)) {
+        processEvent(completed);
+    }
+}
+
+void Game::processEvent(const Event &event)
+{
+    inputState.update(event);
+
+    if (event.type == EventType::QUIT) {
+        running = false;
+        Logger::debug << "Game::run(): event has type EventType::QUIT";
+    }
+
+    _onEvent(event);
+}
+
 void Game::_onRender()
 {
     bool suppress = onRender();
@@ -119,7 +315,7 @@ void Game::_onRender()
     if (currentScene) {
         auto graphicsInterface = interfaceContainer.getGraphicsInterface();
         graphicsInterface->clear();
-        currentScene->_onRender();
+        currentScene->_onRender(frameDelta);
         graphicsInterface->draw();
     }
 }
@@ -132,7 +328,7 @@ void Game::_onLoop()
     }
 
     if (currentScene) {
-        currentScene->_onLoop();
+        currentScene->_onLoop(frameDelta);
     }
 }
 
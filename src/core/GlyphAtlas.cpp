@@ -0,0 +1,264 @@
+#include "core/GlyphAtlas.h"
+#include "interfaces/FontInterface.h"
+#include "utils/DistanceField.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace bkengine;
+
+
+namespace
+{
+    /** returns U+FFFD for malformed sequences */
+    uint32_t decodeUtf8(const std::string &text, size_t &index)
+    {
+        auto byte = static_cast<uint8_t>(text[index++]);
+        if (byte < 0x80) {
+            return byte;
+        }
+
+        size_t length;
+        uint32_t codepoint;
+        if ((byte & 0xe0) == 0xc0) {
+            length = 1;
+            codepoint = byte & 0x1f;
+        } else if ((byte & 0xf0) == 0xe0) {
+            length = 2;
+            codepoint = byte & 0x0f;
+        } else if ((byte & 0xf8) == 0xf0) {
+            length = 3;
+            codepoint = byte & 0x07;
+        } else {
+            return 0xfffd;
+        }
+
+        for (size_t i = 0; i < length; ++i) {
+            if (index >= text.size() || (static_cast<uint8_t>(text[index]) & 0xc0) != 0x80) {
+                return 0xfffd;
+            }
+            codepoint = (codepoint << 6) | (static_cast<uint8_t>(text[index++]) & 0x3f);
+        }
+        return codepoint;
+    }
+}
+
+
+const uint32_t GlyphAtlas::PAGE_SIZE;
+const uint32_t GlyphAtlas::SDF_SIZE;
+const uint32_t GlyphAtlas::SDF_SPREAD;
+const uint32_t GlyphAtlas::FALLBACK_CODEPOINT;
+
+GlyphAtlas::GlyphAtlas(const std::shared_ptr<FontInterface> &fontInterface,
+                       const std::string &fontName,
+                       double fontSize,
+                       TextQuality quality)
+    : fontInterface(fontInterface),
+      fontName(fontName),
+      fontSize(fontSize),
+      quality(quality),
+      packer(PAGE_SIZE, PAGE_SIZE, 1)
+{
+}
+
+bool GlyphAtlas::layout(const std::string &text, TextLayout &layout, double scale, const GlyphBitmaps *rasterized)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // keep every glyph whose code units all belong to the unchanged prefix
+    bool rescaled = layout.scale != scale;
+    size_t kept = 0;
+    if (!rescaled) {
+        auto prefix = std::mismatch(text.cbegin(), text.cend(), layout.text.cbegin(), layout.text.cend());
+        size_t common = std::min(prefix.first - text.cbegin(), prefix.second - layout.text.cbegin());
+        while (kept < layout.glyphs.size()) {
+            size_t end = kept + 1 < layout.glyphs.size() ? layout.glyphs[kept + 1].offset : layout.text.size();
+            if (end > common) {
+                break;
+            }
+            ++kept;
+        }
+    }
+
+    size_t index = 0;
+    if (!rescaled) {
+        index = kept < layout.glyphs.size() ? layout.glyphs[kept].offset : layout.text.size();
+    }
+
+    // the glyphs of the changed suffix are looked up first, a failure leaves the layout untouched
+    std::vector<std::pair<size_t, const Glyph *>> suffix;
+    while (index < text.size()) {
+        size_t offset = index;
+        auto glyph = getGlyph(decodeUtf8(text, index), rasterized);
+        if (glyph == nullptr) {
+            return false;
+        }
+        suffix.push_back({offset, glyph});
+    }
+
+    if (rescaled) {
+        layout = TextLayout();
+        layout.scale = scale;
+    } else if (kept < layout.glyphs.size()) {
+        auto &glyph = layout.glyphs[kept];
+        layout.pen = glyph.pen;
+        layout.bounds.h = glyph.height;
+        layout.quads.resize(glyph.quad);
+        layout.glyphs.resize(kept);
+    }
+    layout.text = text;
+
+    for (auto &entry : suffix) {
+        auto glyph = entry.second;
+        layout.glyphs.push_back({entry.first, layout.pen, layout.quads.size(), layout.bounds.h});
+        if (glyph->source.w > 0 && glyph->source.h > 0) {
+            AbsRect destination(layout.pen + glyph->offsetX * scale,
+                                glyph->offsetY * scale,
+                                glyph->source.w * scale,
+                                glyph->source.h * scale);
+            layout.quads.push_back({glyph->page, glyph->source, destination});
+            layout.bounds.h = std::max(layout.bounds.h, destination.y + destination.h);
+        }
+        layout.pen += glyph->advance * scale;
+    }
+
+    layout.bounds.w = std::max(layout.pen, 0.0);
+    return true;
+}
+
+void GlyphAtlas::rasterize(const std::string &text, GlyphBitmaps &bitmaps)
+{
+    std::vector<uint32_t> missing;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t index = 0;
+        while (index < text.size()) {
+            uint32_t codepoint = decodeUtf8(text, index);
+            if (glyphs.count(codepoint) == 0 && bitmaps.count(codepoint) == 0) {
+                missing.push_back(codepoint);
+                bitmaps[codepoint];
+            }
+        }
+    }
+
+    // rendered outside of the lock, layouts of other texts continue meanwhile
+    bool failed = false;
+    for (uint32_t codepoint : missing) {
+        if (!renderGlyph(codepoint, bitmaps[codepoint])) {
+            bitmaps.erase(codepoint);
+            failed = true;
+        }
+    }
+
+    if (failed && bitmaps.count(FALLBACK_CODEPOINT) == 0) {
+        GlyphBitmap fallback;
+        if (renderGlyph(FALLBACK_CODEPOINT, fallback)) {
+            bitmaps[FALLBACK_CODEPOINT] = std::move(fallback);
+        }
+    }
+}
+
+std::shared_ptr<ImageTexture> GlyphAtlas::getPage(uint32_t index)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return pages.at(index);
+}
+
+uint32_t GlyphAtlas::getPageCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return pages.size();
+}
+
+size_t GlyphAtlas::getGlyphCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return glyphs.size();
+}
+
+std::string GlyphAtlas::getFontName() const
+{
+    return fontName;
+}
+
+double GlyphAtlas::getFontSize() const
+{
+    return fontSize;
+}
+
+TextQuality GlyphAtlas::getQuality() const
+{
+    return quality;
+}
+
+
+const GlyphAtlas::Glyph *GlyphAtlas::getGlyph(uint32_t codepoint, const GlyphBitmaps *rasterized)
+{
+    auto result = glyphs.find(codepoint);
+    if (result != glyphs.end()) {
+        return &result->second;
+    }
+
+    GlyphBitmap rendered;
+    const GlyphBitmap *found = nullptr;
+    if (rasterized != nullptr) {
+        auto entry = rasterized->find(codepoint);
+        found = entry != rasterized->end() ? &entry->second : nullptr;
+    }
+    if (found == nullptr && renderGlyph(codepoint, rendered)) {
+        found = &rendered;
+    }
+
+    if (found == nullptr || found->width > PAGE_SIZE || found->height > PAGE_SIZE) {
+        // glyphs the font cannot render are drawn as the fallback and never requested again,
+        // without a fallback the interface does not support glyph rendering at all
+        if (codepoint == FALLBACK_CODEPOINT) {
+            return nullptr;
+        }
+
+        auto fallback = getGlyph(FALLBACK_CODEPOINT, rasterized);
+        if (fallback == nullptr) {
+            return nullptr;
+        }
+        return &(glyphs[codepoint] = *fallback);
+    }
+
+    const GlyphBitmap &bitmap = *found;
+    Glyph glyph = {0, {0, 0, 0, 0}, bitmap.offsetX, bitmap.offsetY, bitmap.advance};
+    if (bitmap.width > 0 && bitmap.height > 0) {
+        if (pages.empty() || !packer.insert(bitmap.width, bitmap.height, glyph.source)) {
+            auto page = fontInterface->createGlyphPage({PAGE_SIZE, PAGE_SIZE}, quality);
+            if (page == nullptr) {
+                return nullptr;
+            }
+            pages.push_back(page);
+            packer.reset();
+            packer.insert(bitmap.width, bitmap.height, glyph.source);
+        }
+
+        glyph.page = pages.size() - 1;
+        fontInterface->updateGlyphPage(pages.back(), glyph.source, bitmap);
+    }
+
+    return &(glyphs[codepoint] = glyph);
+}
+
+bool GlyphAtlas::renderGlyph(uint32_t codepoint, GlyphBitmap &bitmap) const
+{
+    if (quality != TextQuality::SDF) {
+        return fontInterface->renderGlyph(fontName, fontSize, quality, codepoint, bitmap);
+    }
+
+    if (!fontInterface->renderGlyph(fontName, fontSize, TextQuality::BLENDED, codepoint, bitmap)) {
+        return false;
+    }
+
+    if (bitmap.width > 0 && bitmap.height > 0) {
+        bitmap.pixels = DistanceField::generate(bitmap.pixels.data(), bitmap.width, bitmap.height, SDF_SPREAD);
+        bitmap.width += 2 * SDF_SPREAD;
+        bitmap.height += 2 * SDF_SPREAD;
+        bitmap.offsetX -= SDF_SPREAD;
+        bitmap.offsetY -= SDF_SPREAD;
+    }
+    return true;
+}
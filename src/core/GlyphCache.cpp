@@ -0,0 +1,32 @@
+#include "core/GlyphCache.h"
+
+using namespace bkengine;
+
+
+std::shared_ptr<GlyphAtlas> GlyphCache::getAtlas(const std::shared_ptr<FontInterface> &fontInterface,
+                                                 const std::string &fontName,
+                                                 double fontSize,
+                                                 TextQuality quality)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // distance fields are scaled, so one atlas serves every size
+    double atlasSize = quality == TextQuality::SDF ? GlyphAtlas::SDF_SIZE : fontSize;
+    auto &atlas = atlases[Key(fontName, atlasSize, quality)];
+    if (atlas == nullptr) {
+        atlas = std::make_shared<GlyphAtlas>(fontInterface, fontName, atlasSize, quality);
+    }
+    return atlas;
+}
+
+size_t GlyphCache::size()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return atlases.size();
+}
+
+void GlyphCache::purge()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    atlases.clear();
+}
@@ -0,0 +1,29 @@
+#include "core/GlyphRunTexture.h"
+
+using namespace bkengine;
+
+
+bool GlyphRunTexture::setText(const std::string &text)
+{
+    return atlas->layout(text, layout, layout.scale);
+}
+
+std::string GlyphRunTexture::getText() const
+{
+    return layout.text;
+}
+
+const std::vector<GlyphQuad> &GlyphRunTexture::getQuads() const
+{
+    return layout.quads;
+}
+
+Size GlyphRunTexture::getTextSize() const
+{
+    return layout.bounds;
+}
+
+std::shared_ptr<GlyphAtlas> GlyphRunTexture::getAtlas() const
+{
+    return atlas;
+}
@@ -0,0 +1,19 @@
+#include "core/ImageTexture.h"
+
+using namespace bkengine;
+
+
+std::shared_ptr<ImageTexture> ImageTexture::clone() const
+{
+    return nullptr;
+}
+
+std::shared_ptr<ImageTexture> ImageTexture::getPage() const
+{
+    return page;
+}
+
+AbsRect ImageTexture::getClip() const
+{
+    return clip;
+}
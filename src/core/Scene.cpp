@@ -1,4 +1,6 @@
 #include "core/Scene.h"
+#include "core/Game.h"
+#include "core/utils/SceneUtils.h"
 
 using namespace bkengine;
 
@@ -23,38 +25,150 @@ std::string Scene::getName() const
     return name;
 }
 
-void Scene::_onRender()
+std::shared_ptr<JobSystem> Scene::getJobSystem() const
+{
+    auto game = parentGame.lock();
+    if (game == nullptr) {
+        return nullptr;
+    }
+    return game->getJobSystem();
+}
+
+std::shared_ptr<MemoryResource> Scene::getMemoryResource() const
+{
+    if (running) {
+        return nullptr;
+    }
+    return arena;
+}
+
+Size Scene::getWindowSize() const
+{
+    auto game = parentGame.lock();
+    if (game == nullptr) {
+        return {0, 0};
+    }
+    return game->getWindowSize();
+}
+
+void Scene::_onRender(uint64_t delta)
 {
     bool suppress = onRender();
     if (suppress) {
         return;
     }
 
+    // animations switched since the last update are drawn from the table as well
+    if (animationStates.isDirty()) {
+        animationStates.rebuild(elements);
+    }
+
     for (auto &element : elements) {
-        element->onRender();
+        element->_onRender(delta);
     }
 }
 
-void Scene::_onLoop()
+void Scene::_onLoop(uint64_t delta)
 {
+    running = true;
+    // changes recorded while events were dispatched
+    SceneUtils::applyDeferredChanges(shared_from_this());
+    // render boxes may move while updating, the hit grid is rebuilt with the next pointer event
+    eventDispatcher.invalidateGeometry();
+
     bool suppress = onLoop();
     if (suppress) {
         return;
     }
 
+    auto jobSystem = getJobSystem();
+    bool concurrent = parallelUpdate && jobSystem != nullptr && jobSystem->getWorkerCount() > 0;
+
+    // structural changes are recorded while elements are updated and applied afterwards
+    deferringChanges = true;
+    try {
+        for (auto &element : elements) {
+            if (!concurrent || !element->threadSafe) {
+                element->onLoop();
+            }
+        }
+
+        if (concurrent) {
+            updateConcurrently(jobSystem);
+        }
+    } catch (...) {
+        deferringChanges = false;
+        SceneUtils::applyDeferredChanges(shared_from_this());
+        throw;
+    }
+
+    deferringChanges = false;
+    SceneUtils::applyDeferredChanges(shared_from_this());
+
+    // advanced with every update, independent of how often the game renders
+    if (animationStates.isDirty()) {
+        animationStates.rebuild(elements);
+    }
+    animationStates.step(delta);
+}
+
+void Scene::updateConcurrently(const std::shared_ptr<JobSystem> &jobSystem)
+{
+    concurrentElements.clear();
     for (auto &element : elements) {
-        element->onLoop();
+        if (element->threadSafe) {
+            concurrentElements.push_back(element.get());
+        }
     }
+
+    auto updateChunk = [this](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            concurrentElements[i]->onLoop();
+        }
+    };
+
+    jobSystem->parallelFor(0, concurrentElements.size(), updateGrainSize, updateChunk);
 }
 
 void Scene::_onEvent(const Event &event)
 {
+    running = true;
     bool suppress = onEvent(event);
     if (suppress) {
         return;
     }
 
-    for (auto &element : elements) {
-        element->onEvent(event);
+    // structural changes are applied with the next update
+    if (eventDispatcher.isDirty()) {
+        eventDispatcher.rebuild(elements);
+    }
+
+    deferringChanges = true;
+    try {
+        auto captured = pointerCapture.lock();
+        auto capturedEntry = captured != nullptr ? elementIndex.find(captured->name) : elementIndex.end();
+        if (captured != nullptr && (capturedEntry == elementIndex.end() || capturedEntry->second != captured)) {
+            pointerCapture.reset();
+            captured = nullptr;
+        }
+
+        if (captured != nullptr && EventDispatcher::isPointerEvent(event)) {
+            captured->onEvent(event);
+        } else if (hitTesting && EventDispatcher::isPointerEvent(event)) {
+            // the event bubbles down from the top-most element under the cursor until one handles it
+            for (auto element : eventDispatcher.getHitReceivers(event, elements, getWindowSize())) {
+                if (element->onEvent(event)) {
+                    break;
+                }
+            }
+        } else {
+            for (auto element : eventDispatcher.getReceivers(event)) {
+                element->onEvent(event);
+            }
+        }
+    } catch (...) {
+        deferringChanges = false;
+        throw;
     }
+    deferringChanges = false;
 }
\ No newline at end of file
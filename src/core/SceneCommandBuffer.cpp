@@ -0,0 +1,199 @@
+#include "core/SceneCommandBuffer.h"
+
+#include "core/Element.h"
+
+using namespace bkengine;
+
+
+bool SceneCommandBuffer::addElement(const std::shared_ptr<Element> &element,
+                                    const std::string &name,
+                                    uint32_t collisionLayer,
+                                    const std::shared_ptr<Element> &elementInScene)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (lookup(name, elementInScene) != nullptr) {
+        return false;
+    }
+
+    pendingAdditions[name] = element;
+    pendingLayers[name] = collisionLayer;
+    commands.push_back({SceneCommandType::ADD_ELEMENT, element, name, collisionLayer});
+    commandCount = commands.size();
+    return true;
+}
+
+std::shared_ptr<Element> SceneCommandBuffer::removeElement(const std::string &name,
+                                                           const std::shared_ptr<Element> &elementInScene)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto element = lookup(name, elementInScene);
+    if (element == nullptr) {
+        return nullptr;
+    }
+
+    if (pendingAdditions.erase(name) == 0) {
+        pendingRemovals.insert(name);
+    }
+    pendingLayers.erase(name);
+
+    commands.push_back({SceneCommandType::REMOVE_ELEMENT, nullptr, name, 0});
+    commandCount = commands.size();
+    return element;
+}
+
+void SceneCommandBuffer::removeAllElements()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    pendingAdditions.clear();
+    pendingLayers.clear();
+    allRemoved = true;
+    commands.push_back({SceneCommandType::REMOVE_ALL_ELEMENTS, nullptr, "", 0});
+    commandCount = commands.size();
+}
+
+bool SceneCommandBuffer::moveElement(const std::string &name,
+                                     uint32_t collisionLayer,
+                                     const std::shared_ptr<Element> &elementInScene)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (lookup(name, elementInScene) == nullptr) {
+        return false;
+    }
+
+    pendingLayers[name] = collisionLayer;
+    commands.push_back({SceneCommandType::MOVE_ELEMENT, nullptr, name, collisionLayer});
+    commandCount = commands.size();
+    return true;
+}
+
+std::shared_ptr<Element> SceneCommandBuffer::getElement(const std::string &name,
+                                                        const std::shared_ptr<Element> &elementInScene) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return lookup(name, elementInScene);
+}
+
+std::vector<std::shared_ptr<Element>>
+SceneCommandBuffer::getElements(const std::vector<std::shared_ptr<Element>> &elementsInScene) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::vector<std::shared_ptr<Element>> elements;
+    for (auto &element : elementsInScene) {
+        if (isVisible(element)) {
+            elements.push_back(element);
+        }
+    }
+
+    auto additions = getAdditions();
+    elements.insert(elements.end(), additions.cbegin(), additions.cend());
+    return elements;
+}
+
+std::vector<std::shared_ptr<Element>>
+SceneCommandBuffer::getCollisionLayer(uint32_t collisionLayer,
+                                      const std::vector<std::shared_ptr<Element>> &layerInScene,
+                                      const std::vector<std::shared_ptr<Element>> &elementsInScene) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto isInLayer = [this, collisionLayer](const std::shared_ptr<Element> &element) {
+        auto layer = pendingLayers.find(element->getName());
+        return layer != pendingLayers.cend() && layer->second == collisionLayer;
+    };
+
+    // same order as after applying: kept elements, moved elements in scene order, additions
+    std::vector<std::shared_ptr<Element>> elements;
+    for (auto &element : layerInScene) {
+        if (isVisible(element) && pendingLayers.count(element->getName()) == 0) {
+            elements.push_back(element);
+        }
+    }
+
+    for (auto &element : elementsInScene) {
+        if (isVisible(element) && isInLayer(element)) {
+            elements.push_back(element);
+        }
+    }
+
+    for (auto &element : getAdditions()) {
+        if (isInLayer(element)) {
+            elements.push_back(element);
+        }
+    }
+
+    return elements;
+}
+
+uint32_t SceneCommandBuffer::getCollisionLayerIndex(const std::string &name, uint32_t collisionLayerInScene) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto layer = pendingLayers.find(name);
+    return layer != pendingLayers.cend() ? layer->second : collisionLayerInScene;
+}
+
+std::vector<SceneCommand> SceneCommandBuffer::takeCommands()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::vector<SceneCommand> taken;
+    std::swap(taken, commands);
+    pendingAdditions.clear();
+    pendingRemovals.clear();
+    pendingLayers.clear();
+    allRemoved = false;
+    commandCount = 0;
+    return taken;
+}
+
+bool SceneCommandBuffer::empty() const
+{
+    return commandCount == 0;
+}
+
+bool SceneCommandBuffer::isRemoved(const std::string &name) const
+{
+    return allRemoved || pendingRemovals.count(name) > 0;
+}
+
+std::shared_ptr<Element> SceneCommandBuffer::lookup(const std::string &name,
+                                                    const std::shared_ptr<Element> &elementInScene) const
+{
+    auto pending = pendingAdditions.find(name);
+    if (pending != pendingAdditions.cend()) {
+        return pending->second;
+    }
+
+    if (elementInScene != nullptr && !isRemoved(name)) {
+        return elementInScene;
+    }
+
+    return nullptr;
+}
+
+bool SceneCommandBuffer::isVisible(const std::shared_ptr<Element> &elementInScene) const
+{
+    return lookup(elementInScene->getName(), elementInScene) == elementInScene;
+}
+
+std::vector<std::shared_ptr<Element>> SceneCommandBuffer::getAdditions() const
+{
+    // additions join the scene in the order they were recorded
+    std::vector<std::shared_ptr<Element>> additions;
+    for (auto &command : commands) {
+        if (command.type != SceneCommandType::ADD_ELEMENT) {
+            continue;
+        }
+        auto pending = pendingAdditions.find(command.name);
+        if (pending != pendingAdditions.cend() && pending->second == command.element) {
+            additions.push_back(command.element);
+        }
+    }
+    return additions;
+}
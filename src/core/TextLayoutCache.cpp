@@ -0,0 +1,120 @@
+#include "core/TextLayoutCache.h"
+
+using namespace bkengine;
+
+
+const size_t TextLayoutCache::DEFAULT_CAPACITY;
+
+TextLayoutCache::TextLayoutCache(size_t capacity) : capacity(capacity)
+{
+}
+
+std::shared_ptr<const TextLayout> TextLayoutCache::get(const std::string &text,
+                                                       const std::string &fontName,
+                                                       double fontSize,
+                                                       TextQuality quality,
+                                                       const std::shared_ptr<const GlyphAtlas> &atlas)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto result = index.find({text, fontName, fontSize, quality});
+    if (result == index.end()) {
+        misses++;
+        return nullptr;
+    }
+
+    // quads of another atlas point to pages and glyphs this one does not have
+    if (result->second->second.atlas.lock() != atlas) {
+        entries.erase(result->second);
+        index.erase(result);
+        misses++;
+        return nullptr;
+    }
+
+    entries.splice(entries.begin(), entries, result->second);
+    hits++;
+    return result->second->second.layout;
+}
+
+void TextLayoutCache::put(const std::string &fontName,
+                          double fontSize,
+                          TextQuality quality,
+                          const std::shared_ptr<const GlyphAtlas> &atlas,
+                          const std::shared_ptr<const TextLayout> &layout)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Key key = {layout->text, fontName, fontSize, quality};
+    auto result = index.find(key);
+    if (result != index.end()) {
+        result->second->second = {layout, atlas};
+        entries.splice(entries.begin(), entries, result->second);
+        return;
+    }
+
+    entries.emplace_front(key, Entry{layout, atlas});
+    index[key] = entries.begin();
+    shrink();
+}
+
+void TextLayoutCache::setCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TextLayoutCache::capacity = capacity;
+    shrink();
+}
+
+size_t TextLayoutCache::getCapacity()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return capacity;
+}
+
+size_t TextLayoutCache::size()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void TextLayoutCache::purge()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+}
+
+uint64_t TextLayoutCache::getHitCount() const
+{
+    return hits;
+}
+
+uint64_t TextLayoutCache::getMissCount() const
+{
+    return misses;
+}
+
+
+void TextLayoutCache::shrink()
+{
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+
+bool TextLayoutCache::Key::operator==(const Key &key) const
+{
+    return text == key.text && fontName == key.fontName && fontSize == key.fontSize && quality == key.quality;
+}
+
+size_t TextLayoutCache::KeyHash::operator()(const Key &key) const
+{
+    size_t hash = std::hash<std::string>()(key.text);
+    for (size_t value : {std::hash<std::string>()(key.fontName),
+                         std::hash<double>()(key.fontSize),
+                         static_cast<size_t>(key.quality)}) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
@@ -0,0 +1,45 @@
+#include "core/TextureAtlas.h"
+
+using namespace bkengine;
+
+
+bool TextureAtlas::hasRegion(const std::string &name) const
+{
+    return regionIndex.find(name) != regionIndex.cend();
+}
+
+const AtlasRegion &TextureAtlas::getRegion(const std::string &name) const
+{
+    auto result = regionIndex.find(name);
+    if (result == regionIndex.cend()) {
+        throw NameNotFoundException("No region found with the name '" + name + "'!");
+    }
+    return regions[result->second];
+}
+
+std::vector<std::string> TextureAtlas::getRegionNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(regions.size());
+    for (auto &region : regions) {
+        names.push_back(region.name);
+    }
+    return names;
+}
+
+uint32_t TextureAtlas::getPageCount() const
+{
+    return pages.size();
+}
+
+std::shared_ptr<ImageTexture> TextureAtlas::getPage(uint32_t page) const
+{
+    assert(page < pages.size());
+
+    return pages[page];
+}
+
+Size TextureAtlas::getPageSize() const
+{
+    return pageSize;
+}
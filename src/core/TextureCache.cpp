@@ -0,0 +1,113 @@
+#include "core/TextureCache.h"
+#include "exceptions/BuilderException.h"
+#include "interfaces/ImageInterface.h"
+
+using namespace bkengine;
+
+
+std::shared_ptr<ImageTexture>
+TextureCache::getImageTexture(ImageInterface &imageInterface, const std::string &filePath, const AbsRect &clip)
+{
+    auto render = [&imageInterface, &filePath, &clip]() {
+        return imageInterface.renderImageFileToTexture(filePath, clip);
+    };
+    return getImageTexture(filePath, clip, render);
+}
+
+std::shared_ptr<ImageTexture>
+TextureCache::getImageTexture(const std::string &filePath,
+                              const AbsRect &clip,
+                              const std::function<std::shared_ptr<ImageTexture>()> &render)
+{
+    Key key = {filePath, clip};
+    std::shared_ptr<ImageTexture> shared = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto result = entries.find(key);
+        if (result != entries.end()) {
+            shared = result->second.lock();
+            if (shared == nullptr) {
+                entries.erase(result);
+            }
+        }
+    }
+
+    if (shared == nullptr) {
+        // rendered outside of the lock, a concurrent miss for the same key only wastes work
+        shared = render();
+        if (shared == nullptr) {
+            throw BuilderException("The image '" + filePath + "' could not be rendered!");
+        }
+
+        auto texture = shared->clone();
+        if (texture == nullptr) {
+            return shared;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = entries[key];
+        auto existing = entry.lock();
+        if (existing != nullptr) {
+            shared = existing;
+            texture = shared->clone();
+        } else {
+            entry = shared;
+        }
+        misses++;
+        texture->page = shared;
+        return texture;
+    }
+
+    auto texture = shared->clone();
+    texture->page = shared;
+    hits++;
+    return texture;
+}
+
+size_t TextureCache::size()
+{
+    purge();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void TextureCache::purge()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.expired()) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint64_t TextureCache::getHitCount() const
+{
+    return hits;
+}
+
+uint64_t TextureCache::getMissCount() const
+{
+    return misses;
+}
+
+
+bool TextureCache::Key::operator==(const Key &key) const
+{
+    return filePath == key.filePath && clip == key.clip;
+}
+
+size_t TextureCache::KeyHash::operator()(const Key &key) const
+{
+    std::hash<double> hashDouble;
+    size_t hash = std::hash<std::string>()(key.filePath);
+    for (double value : {key.clip.x, key.clip.y, key.clip.w, key.clip.h}) {
+        hash ^= hashDouble(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
@@ -22,6 +22,18 @@ AnimationBuilder &AnimationBuilder::setParentElement(const std::shared_ptr<Eleme
 
 AnimationBuilder &AnimationBuilder::setFramesPerTexture(uint32_t frames)
 {
-    AnimationBuilder::framesPerTexture = frames;
+    frameDuration = frames * 1000000ull / 60;
+    return *this;
+}
+
+AnimationBuilder &AnimationBuilder::setFrameDuration(double milliseconds)
+{
+    frameDuration = milliseconds > 0 ? static_cast<uint64_t>(milliseconds * 1000) : 0;
+    return *this;
+}
+
+AnimationBuilder &AnimationBuilder::setFramesPerSecond(double fps)
+{
+    frameDuration = fps > 0 ? static_cast<uint64_t>(1000000 / fps) : 0;
     return *this;
 }
\ No newline at end of file
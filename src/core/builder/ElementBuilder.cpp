@@ -36,4 +36,16 @@ ElementBuilder &ElementBuilder::setCollisionLayer(uint32_t collisionLayer)
 {
     ElementBuilder::collisionLayer = collisionLayer;
     return *this;
-}
\ No newline at end of file
+}
+
+ElementBuilder &ElementBuilder::setThreadSafe(bool threadSafe)
+{
+    ElementBuilder::threadSafe = threadSafe;
+    return *this;
+}
+
+ElementBuilder &ElementBuilder::addEventSubscription(const EventSubscription &subscription)
+{
+    subscriptions.push_back(subscription);
+    return *this;
+}
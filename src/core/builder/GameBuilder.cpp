@@ -24,4 +24,66 @@ GameBuilder &GameBuilder::setIconFile(const std::string &file)
 {
     iconFile = file;
     return *this;
-}
\ No newline at end of file
+}
+
+GameBuilder &GameBuilder::setWorkerCount(uint32_t count)
+{
+    workerCount = count;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setImageCacheDirectory(const std::string &directory)
+{
+    imageCacheDirectory = directory;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setTextLayoutCacheSize(size_t size)
+{
+    textLayoutCacheSize = size;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setInputThread(bool enabled, size_t queueCapacity)
+{
+    if (queueCapacity == 0 || (queueCapacity & (queueCapacity - 1)) != 0) {
+        throw BuilderException("The event queue capacity has to be a power of two!");
+    }
+    inputThread = enabled;
+    eventQueueCapacity = queueCapacity;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setEventCoalescing(EventType type, bool enabled)
+{
+    if (!EventCoalescer::isCoalescible(type)) {
+        throw BuilderException("Only motion and wheel events can be coalesced!");
+    }
+    eventCoalescer.setCoalescing(type, enabled);
+    return *this;
+}
+
+GameBuilder &GameBuilder::setEventRecording(const std::string &filePath)
+{
+    eventRecordingFile = filePath;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setEventReplay(const std::string &filePath)
+{
+    eventReplayFile = filePath;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setHeadless(bool enabled, uint32_t renderInterval)
+{
+    headless = enabled;
+    GameBuilder::renderInterval = enabled ? renderInterval : 1;
+    return *this;
+}
+
+GameBuilder &GameBuilder::setMaxFrames(uint64_t frames)
+{
+    maxFrames = frames;
+    return *this;
+}
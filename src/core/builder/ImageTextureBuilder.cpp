@@ -1,5 +1,9 @@
 #include "core/builder/ImageTextureBuilder.h"
 
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 using namespace bkengine;
 
 
@@ -27,6 +31,14 @@ ImageTextureBuilder &ImageTextureBuilder::setClip(const AbsRect &clip)
     return *this;
 }
 
+ImageTextureBuilder &ImageTextureBuilder::setAtlasRegion(const std::shared_ptr<TextureAtlas> &atlas,
+                                                         const std::string &region)
+{
+    ImageTextureBuilder::atlas = atlas;
+    regionName = region;
+    return *this;
+}
+
 ImageTextureBuilder &ImageTextureBuilder::setTexturePosition(const Point &position)
 {
     ImageTextureBuilder::position = position;
@@ -52,27 +64,79 @@ ImageTextureBuilder &ImageTextureBuilder::setFlip(bool horizontal, bool vertical
     return *this;
 }
 
+ImageTextureBuilder &ImageTextureBuilder::setPlaceholder(const std::shared_ptr<Texture> &placeholder)
+{
+    ImageTextureBuilder::placeholder = placeholder;
+    return *this;
+}
+
+ImageTextureBuilder &ImageTextureBuilder::setCached(bool cached)
+{
+    ImageTextureBuilder::cached = cached;
+    return *this;
+}
+
 
 std::shared_ptr<Texture> ImageTextureBuilder::build() const
 {
-    if (game == nullptr) {
-        throw BuilderException("You have to set the target game for the texture!");
-    }
+    validate();
 
-    if (name.empty()) {
-        throw BuilderException("You have to specify a name for the texture!");
-    }
+    return build(*game);
+}
 
-    if (filePath.empty()) {
-        throw BuilderException("A file for the image has to be set!");
-    }
+std::shared_ptr<AsyncTexture> ImageTextureBuilder::buildAsync(int32_t priority) const
+{
+    validate();
+
+    auto asyncTexture = std::shared_ptr<AsyncTexture>(new AsyncTexture());
+    asyncTexture->size = textureSize;
+    asyncTexture->name = name;
+    asyncTexture->position = position;
+    asyncTexture->angle = angleRadians;
+    asyncTexture->flipHorizontally = flipHorizontally;
+    asyncTexture->flipVertically = flipVertically;
+    asyncTexture->placeholder = placeholder;
+
+    // the load refers to the game without owning it, see AssetLoader
+    auto builder = *this;
+    builder.game = nullptr;
+    Game *target = game.get();
+    auto load = [builder, target]() -> AssetLoader::Upload {
+        auto image = std::make_shared<DecodedImage>();
+        bool packed;
+        if (builder.atlas != nullptr || !builder.decodeImage(*target, builder.readImage(*target, packed), *image)) {
+            // rendered on the game loop thread by interfaces without decoding support
+            return [builder, target]() { return builder.build(*target); };
+        }
+        return [builder, target, image]() { return builder.build(*target, image.get()); };
+    };
+    game->getAssetLoader()->load(asyncTexture, load, priority);
+    return asyncTexture;
+}
 
-    auto imageInterface = game->interfaceContainer.getImageInterface();
-    if (imageInterface == nullptr) {
-        throw BuilderException("The given game has to have an image interface set!");
+
+std::shared_ptr<Texture> ImageTextureBuilder::build(Game &target, const DecodedImage *image) const
+{
+    auto imageInterface = target.interfaceContainer.getImageInterface();
+    std::shared_ptr<ImageTexture> texture = nullptr;
+
+    if (atlas != nullptr) {
+        auto &region = atlas->getRegion(regionName);
+        auto page = atlas->getPage(region.page);
+        texture = imageInterface->createPageTexture(page, region.destination);
+        if (texture == nullptr) {
+            throw BuilderException("The image interface of the given game does not support texture atlases!");
+        }
+        texture->page = page;
+        texture->clip = region.destination;
+    } else {
+        auto render = [this, &target, image]() { return renderImage(target, image); };
+        texture = cached ? target.textureCache.getImageTexture(filePath, clipRect, render) : render();
+        if (texture == nullptr) {
+            throw BuilderException("The image '" + filePath + "' could not be rendered!");
+        }
     }
 
-    std::shared_ptr<Texture> texture = imageInterface->renderImageFileToTexture(filePath, clipRect);
     texture->size = textureSize;
     texture->name = name;
     texture->position = position;
@@ -81,4 +145,94 @@ std::shared_ptr<Texture> ImageTextureBuilder::build() const
     texture->flipVertically = flipVertically;
     
     return texture;
-}
\ No newline at end of file
+}
+
+void ImageTextureBuilder::validate() const
+{
+    if (game == nullptr) {
+        throw BuilderException("You have to set the target game for the texture!");
+    }
+
+    if (name.empty()) {
+        throw BuilderException("You have to specify a name for the texture!");
+    }
+
+    if (filePath.empty() && atlas == nullptr) {
+        throw BuilderException("A file or an atlas region for the image has to be set!");
+    }
+
+    if (game->interfaceContainer.getImageInterface() == nullptr) {
+        throw BuilderException("The given game has to have an image interface set!");
+    }
+}
+
+std::shared_ptr<ImageTexture> ImageTextureBuilder::renderImage(Game &target, const DecodedImage *image) const
+{
+    auto imageInterface = target.interfaceContainer.getImageInterface();
+    if (image != nullptr) {
+        auto texture = imageInterface->uploadImage(*image, clipRect);
+        if (texture != nullptr) {
+            return texture;
+        }
+    }
+
+    bool packed;
+    AssetData data = {nullptr, 0, nullptr};
+    if (image == nullptr && target.imageDiskCache != nullptr) {
+        data = readImage(target, packed);
+        DecodedImage decoded;
+        if (decodeImage(target, data, decoded)) {
+            auto texture = imageInterface->uploadImage(decoded, clipRect);
+            if (texture != nullptr) {
+                return texture;
+            }
+        }
+    } else {
+        packed = GameUtils::findAsset(target, filePath, data);
+    }
+
+    // files packed into a mounted archive are rendered from memory if the interface supports it
+    if (packed) {
+        auto texture = imageInterface->renderImageDataToTexture(data, clipRect);
+        if (texture != nullptr) {
+            return texture;
+        }
+    }
+    return imageInterface->renderImageFileToTexture(filePath, clipRect);
+}
+
+AssetData ImageTextureBuilder::readImage(Game &target, bool &packed) const
+{
+    AssetData data = {nullptr, 0, nullptr};
+    packed = GameUtils::findAsset(target, filePath, data);
+    if (!packed) {
+        std::ifstream file(filePath, std::ios::binary);
+        auto bytes = std::make_shared<std::vector<uint8_t>>(std::istreambuf_iterator<char>(file),
+                                                            std::istreambuf_iterator<char>());
+        data = {bytes->data(), bytes->size(), bytes};
+    }
+    return data;
+}
+
+bool ImageTextureBuilder::decodeImage(Game &target, const AssetData &data, DecodedImage &image) const
+{
+    if (data.size == 0) {
+        return false;
+    }
+
+    auto imageInterface = target.interfaceContainer.getImageInterface();
+    auto diskCache = target.imageDiskCache;
+    if (diskCache == nullptr) {
+        return imageInterface->decodeImage(data, image);
+    }
+
+    uint64_t hash = ImageDiskCache::hash(data.data, data.size);
+    if (diskCache->load(hash, image)) {
+        return true;
+    }
+    if (!imageInterface->decodeImage(data, image)) {
+        return false;
+    }
+    diskCache->store(hash, image);
+    return true;
+}
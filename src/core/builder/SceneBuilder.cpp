@@ -18,4 +18,28 @@ SceneBuilder &SceneBuilder::setParentGame(const std::shared_ptr<Game> &parentGam
 {
     SceneBuilder::parentGame = parentGame;
     return *this;
+}
+
+SceneBuilder &SceneBuilder::setParallelUpdate(bool parallelUpdate)
+{
+    SceneBuilder::parallelUpdate = parallelUpdate;
+    return *this;
+}
+
+SceneBuilder &SceneBuilder::setUpdateGrainSize(uint32_t grainSize)
+{
+    updateGrainSize = grainSize;
+    return *this;
+}
+
+SceneBuilder &SceneBuilder::setArenaSize(size_t size)
+{
+    arenaSize = size;
+    return *this;
+}
+
+SceneBuilder &SceneBuilder::setHitTesting(bool hitTesting)
+{
+    SceneBuilder::hitTesting = hitTesting;
+    return *this;
 }
\ No newline at end of file
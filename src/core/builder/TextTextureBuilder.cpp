@@ -64,8 +64,78 @@ TextTextureBuilder &TextTextureBuilder::setFlip(bool horizontal, bool vertical)
     return *this;
 }
 
+TextTextureBuilder &TextTextureBuilder::setPlaceholder(const std::shared_ptr<Texture> &placeholder)
+{
+    TextTextureBuilder::placeholder = placeholder;
+    return *this;
+}
+
+TextTextureBuilder &TextTextureBuilder::setCached(bool cached)
+{
+    TextTextureBuilder::cached = cached;
+    return *this;
+}
+
 
 std::shared_ptr<Texture> TextTextureBuilder::build() const
+{
+    validate();
+
+    return build(*game);
+}
+
+std::shared_ptr<AsyncTexture> TextTextureBuilder::buildAsync(int32_t priority) const
+{
+    validate();
+
+    auto asyncTexture = std::shared_ptr<AsyncTexture>(new AsyncTexture());
+    asyncTexture->size = textureSize;
+    asyncTexture->name = name;
+    asyncTexture->position = position;
+    asyncTexture->angle = angleRadians;
+    asyncTexture->flipHorizontally = flipHorizontally;
+    asyncTexture->flipVertically = flipVertically;
+    asyncTexture->placeholder = placeholder;
+
+    // the load refers to the game without owning it, see AssetLoader
+    auto builder = *this;
+    builder.game = nullptr;
+    Game *target = game.get();
+    auto load = [builder, target]() -> AssetLoader::Upload {
+        auto glyphs = builder.rasterize(*target);
+        return [builder, target, glyphs]() { return builder.build(*target, glyphs.get()); };
+    };
+    game->getAssetLoader()->load(asyncTexture, load, priority);
+    return asyncTexture;
+}
+
+
+std::shared_ptr<Texture> TextTextureBuilder::build(Game &target, const GlyphBitmaps *rasterized) const
+{
+    TextQuality renderedQuality = quality;
+    std::shared_ptr<TextTexture> texture = cached ? renderGlyphRun(target, rasterized) : nullptr;
+    if (texture == nullptr) {
+        // distance fields need glyph support, whole texts are rendered smooth instead
+        if (renderedQuality == TextQuality::SDF) {
+            renderedQuality = TextQuality::BLENDED;
+        }
+        auto fontInterface = target.interfaceContainer.getFontInterface();
+        texture = fontInterface->renderFontToTexture(text, fontName, fontSize, renderedQuality);
+    }
+
+    texture->fontName = fontName;
+    texture->quality = renderedQuality;
+    texture->size = textureSize;
+    texture->name = name;
+    texture->position = position;
+    texture->angle = angleRadians;
+    texture->flipHorizontally = flipHorizontally;
+    texture->flipVertically = flipVertically;
+    
+    return texture;
+}
+
+void TextTextureBuilder::validate() const
 {
     if (game == nullptr) {
         throw BuilderException("You have to set the target game for the texture!");
@@ -87,18 +157,40 @@ std::shared_ptr<Texture> TextTextureBuilder::build() const
         throw BuilderException("The font size has to be set to a value greater than 0!");
     }
 
-    auto fontInterface = game->interfaceContainer.getFontInterface();
-    if (fontInterface == nullptr) {
+    if (game->interfaceContainer.getFontInterface() == nullptr) {
         throw BuilderException("The given game has to have a font interface set!");
     }
+}
 
-    std::shared_ptr<Texture> texture = fontInterface->renderFontToTexture(text, fontName, fontSize, quality);
-    texture->size = textureSize;
-    texture->name = name;
-    texture->position = position;
-    texture->angle = angleRadians;
-    texture->flipHorizontally = flipHorizontally;
-    texture->flipVertically = flipVertically;
-    
+std::shared_ptr<TextTexture> TextTextureBuilder::renderGlyphRun(Game &target, const GlyphBitmaps *rasterized) const
+{
+    auto fontInterface = target.interfaceContainer.getFontInterface();
+    auto texture = fontInterface->createGlyphRunTexture();
+    if (texture == nullptr) {
+        return nullptr;
+    }
+
+    // identical texts are laid out once, later builds only copy the quads
+    auto atlas = target.glyphCache.getAtlas(fontInterface, fontName, fontSize, quality);
+    auto layout = target.textLayoutCache.get(text, fontName, fontSize, quality, atlas);
+    if (layout != nullptr) {
+        texture->layout = *layout;
+    } else if (atlas->layout(text, texture->layout, fontSize / atlas->getFontSize(), rasterized)) {
+        target.textLayoutCache.put(fontName, fontSize, quality, atlas, std::make_shared<TextLayout>(texture->layout));
+    } else {
+        return nullptr;
+    }
+
+    texture->atlas = atlas;
     return texture;
-}
\ No newline at end of file
+}
+
+std::shared_ptr<GlyphBitmaps> TextTextureBuilder::rasterize(Game &target) const
+{
+    auto glyphs = std::make_shared<GlyphBitmaps>();
+    if (cached) {
+        auto fontInterface = target.interfaceContainer.getFontInterface();
+        target.glyphCache.getAtlas(fontInterface, fontName, fontSize, quality)->rasterize(text, *glyphs);
+    }
+    return glyphs;
+}
@@ -0,0 +1,155 @@
+#include "core/builder/TextureAtlasBuilder.h"
+
+#include <algorithm>
+
+using namespace bkengine;
+
+
+TextureAtlasBuilder TextureAtlasBuilder::createBuilder()
+{
+    return TextureAtlasBuilder();
+}
+
+TextureAtlasBuilder &TextureAtlasBuilder::setGame(const std::shared_ptr<Game> &game)
+{
+    TextureAtlasBuilder::game = game;
+    return *this;
+}
+
+TextureAtlasBuilder &TextureAtlasBuilder::setPageSize(const Size &pageSize)
+{
+    TextureAtlasBuilder::pageSize = pageSize;
+    return *this;
+}
+
+TextureAtlasBuilder &TextureAtlasBuilder::setPadding(uint32_t padding)
+{
+    TextureAtlasBuilder::padding = padding;
+    return *this;
+}
+
+TextureAtlasBuilder &
+TextureAtlasBuilder::addImage(const std::string &name, const std::string &filePath, const AbsRect &clip)
+{
+    auto sameName = [&name](const AtlasRegion &image) { return image.name == name; };
+    if (std::find_if(images.cbegin(), images.cend(), sameName) != images.cend()) {
+        throw NameAlreadyExistsException("Image '" + name + "' already exists in atlas!");
+    }
+
+    images.push_back({name, filePath, clip, 0, {}});
+    return *this;
+}
+
+
+std::vector<AtlasRegion> TextureAtlasBuilder::buildLayout() const
+{
+    if (pageSize.w < 1 || pageSize.h < 1) {
+        throw BuilderException("The atlas pages must not be empty!");
+    }
+
+    std::shared_ptr<ImageInterface> imageInterface = nullptr;
+    if (game != nullptr) {
+        imageInterface = game->interfaceContainer.getImageInterface();
+    }
+
+    auto regions = images;
+    for (auto &region : regions) {
+        if (region.source.w > 0 && region.source.h > 0) {
+            continue;
+        }
+
+        if (imageInterface == nullptr) {
+            throw BuilderException("Images without clip can only be packed with a game that has an image interface!");
+        }
+
+        Size size = imageInterface->getImageSize(region.filePath);
+        if (size.w < 1 || size.h < 1) {
+            throw BuilderException("The size of the image '" + region.filePath + "' could not be determined!");
+        }
+        region.source = AbsRect(0, 0, size.w, size.h);
+    }
+
+    // packing the tallest images first leaves the flattest skyline
+    std::vector<size_t> order(regions.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&regions](size_t first, size_t second) {
+        auto &a = regions[first].source;
+        auto &b = regions[second].source;
+        return a.h > b.h || (a.h == b.h && a.w > b.w);
+    });
+
+    uint32_t pageWidth = static_cast<uint32_t>(pageSize.w);
+    uint32_t pageHeight = static_cast<uint32_t>(pageSize.h);
+    std::vector<RectPacker> packers;
+
+    for (size_t index : order) {
+        auto &region = regions[index];
+        uint32_t width = static_cast<uint32_t>(std::ceil(region.source.w));
+        uint32_t height = static_cast<uint32_t>(std::ceil(region.source.h));
+
+        if (width > pageWidth || height > pageHeight) {
+            throw BuilderException("Image '" + region.name + "' does not fit on an atlas page!");
+        }
+
+        bool placed = false;
+        for (size_t page = 0; page < packers.size() && !placed; ++page) {
+            placed = packers[page].insert(width, height, region.destination);
+            region.page = page;
+        }
+
+        if (!placed) {
+            packers.emplace_back(pageWidth, pageHeight, padding);
+            placed = packers.back().insert(width, height, region.destination);
+            region.page = packers.size() - 1;
+        }
+
+        assert(placed);
+    }
+
+    return regions;
+}
+
+std::shared_ptr<TextureAtlas> TextureAtlasBuilder::build() const
+{
+    if (game == nullptr) {
+        throw BuilderException("You have to set the target game for the atlas!");
+    }
+
+    auto imageInterface = game->interfaceContainer.getImageInterface();
+    if (imageInterface == nullptr) {
+        throw BuilderException("The given game has to have an image interface set!");
+    }
+
+    auto regions = buildLayout();
+
+    uint32_t pageCount = 0;
+    for (auto &region : regions) {
+        pageCount = std::max(pageCount, region.page + 1);
+    }
+
+    auto atlas = std::shared_ptr<TextureAtlas>(new TextureAtlas());
+    atlas->pageSize = pageSize;
+
+    for (uint32_t page = 0; page < pageCount; ++page) {
+        std::vector<AtlasRegion> pageRegions;
+        std::copy_if(regions.cbegin(),
+                     regions.cend(),
+                     std::back_inserter(pageRegions),
+                     [page](const AtlasRegion &region) { return region.page == page; });
+
+        auto texture = imageInterface->renderAtlasPage(pageSize, pageRegions);
+        if (texture == nullptr) {
+            throw BuilderException("The image interface of the given game does not support texture atlases!");
+        }
+        atlas->pages.push_back(texture);
+    }
+
+    for (size_t i = 0; i < regions.size(); ++i) {
+        atlas->regionIndex[regions[i].name] = i;
+    }
+    atlas->regions = std::move(regions);
+
+    return atlas;
+}
@@ -13,6 +13,7 @@ void AnimationUtils::addTexture(const std::shared_ptr<Animation> &animation, con
     }
 
     animation->textures.push_back(texture);
+    markDirty(animation);
 }
 
 bool AnimationUtils::hasTexture(const std::shared_ptr<Animation> &animation, const std::string &name)
@@ -42,6 +43,7 @@ std::shared_ptr<Texture> AnimationUtils::removeTexture(const std::shared_ptr<Ani
 
     auto texture = *result;
     textures.erase(result);
+    markDirty(animation);
 
     return texture;
 }
@@ -52,6 +54,7 @@ std::vector<std::shared_ptr<Texture>> AnimationUtils::removeAllTextures(const st
 
     auto texturesCopy = animation->textures;
     animation->textures.clear();
+    markDirty(animation);
     return texturesCopy;
 }
 
@@ -94,6 +97,14 @@ uint32_t AnimationUtils::getTextureCount(const std::shared_ptr<Animation> &anima
 
 std::shared_ptr<Texture> AnimationUtils::getCurrentTexture(const std::shared_ptr<Animation> &animation)
 {
-    assert(animation->currentTextureIndex < animation->textures.size());
-    return animation->textures[animation->currentTextureIndex];
+    assert(animation->getCurrentFrame() < animation->textures.size());
+    return animation->textures[animation->getCurrentFrame()];
+}
+
+
+void AnimationUtils::markDirty(const std::shared_ptr<Animation> &animation)
+{
+    if (animation->stateTable != nullptr) {
+        animation->stateTable->markDirty();
+    }
 }
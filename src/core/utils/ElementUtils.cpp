@@ -1,4 +1,5 @@
 #include "core/utils/ElementUtils.h"
+#include "core/Scene.h"
 
 using namespace bkengine;
 
@@ -100,9 +101,64 @@ void ElementUtils::activateAnimation(const std::shared_ptr<Element> &element, co
     }
 
     element->currentAnimation = getAnimation(element, name);
+
+    auto scene = element->parentScene.lock();
+    if (scene != nullptr) {
+        scene->animationStates.markDirty();
+    }
 }
 
 std::shared_ptr<Animation> ElementUtils::getCurrentAnimation(const std::shared_ptr<Element> &element)
 {
     return element->currentAnimation;
-}
\ No newline at end of file
+}
+
+void ElementUtils::subscribe(const std::shared_ptr<Element> &element, const EventSubscription &subscription)
+{
+    assert(element != nullptr);
+
+    element->subscribedToAll = false;
+    element->subscriptions.push_back(subscription);
+    markSubscriptionsDirty(element);
+}
+
+void ElementUtils::unsubscribeAll(const std::shared_ptr<Element> &element)
+{
+    assert(element != nullptr);
+
+    element->subscribedToAll = false;
+    element->subscriptions.clear();
+    markSubscriptionsDirty(element);
+}
+
+void ElementUtils::subscribeToAll(const std::shared_ptr<Element> &element)
+{
+    assert(element != nullptr);
+
+    element->subscribedToAll = true;
+    element->subscriptions.clear();
+    markSubscriptionsDirty(element);
+}
+
+std::vector<EventSubscription> ElementUtils::getSubscriptions(const std::shared_ptr<Element> &element)
+{
+    assert(element != nullptr);
+
+    return element->subscriptions;
+}
+
+bool ElementUtils::isSubscribedToAll(const std::shared_ptr<Element> &element)
+{
+    assert(element != nullptr);
+
+    return element->subscribedToAll;
+}
+
+
+void ElementUtils::markSubscriptionsDirty(const std::shared_ptr<Element> &element)
+{
+    auto scene = element->parentScene.lock();
+    if (scene != nullptr) {
+        scene->eventDispatcher.markDirty();
+    }
+}
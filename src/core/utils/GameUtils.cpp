@@ -116,4 +116,66 @@ std::shared_ptr<Scene> GameUtils::getCurrentScene(const std::shared_ptr<Game> &g
     assert(game != nullptr);
 
     return game->currentScene;
-}
\ No newline at end of file
+}
+
+void GameUtils::mountArchive(const std::shared_ptr<Game> &game, const std::shared_ptr<AssetArchive> &archive)
+{
+    assert(game != nullptr);
+    assert(archive != nullptr);
+
+    std::lock_guard<std::mutex> lock(game->archiveMutex);
+    game->archives.push_back(archive);
+}
+
+void GameUtils::unmountArchive(const std::shared_ptr<Game> &game, const std::shared_ptr<AssetArchive> &archive)
+{
+    assert(game != nullptr);
+
+    std::lock_guard<std::mutex> lock(game->archiveMutex);
+    auto &archives = game->archives;
+    archives.erase(std::remove(archives.begin(), archives.end(), archive), archives.end());
+}
+
+bool GameUtils::findAsset(const std::shared_ptr<Game> &game, const std::string &name, AssetData &data)
+{
+    assert(game != nullptr);
+
+    return findAsset(*game, name, data);
+}
+
+bool GameUtils::findAsset(Game &game, const std::string &name, AssetData &data)
+{
+    std::shared_ptr<AssetArchive> archive = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(game.archiveMutex);
+        auto &archives = game.archives;
+        auto hasAsset = [&name](const std::shared_ptr<AssetArchive> &archive) { return archive->hasEntry(name); };
+        auto result = std::find_if(archives.crbegin(), archives.crend(), hasAsset);
+        if (result == archives.crend()) {
+            return false;
+        }
+        archive = *result;
+    }
+
+    data = archive->getData(name);
+    return true;
+}
+
+void GameUtils::registerFont(const std::shared_ptr<Game> &game,
+                             const std::string &filePath,
+                             const std::string &fontName,
+                             double size)
+{
+    assert(game != nullptr);
+
+    auto fontInterface = game->interfaceContainer.getFontInterface();
+    if (fontInterface == nullptr) {
+        throw NullPointerException("Failed to register font. Font interface is not set!");
+    }
+
+    AssetData data;
+    if (findAsset(game, filePath, data) && fontInterface->registerFontData(data, fontName, size)) {
+        return;
+    }
+    fontInterface->registerFont(filePath, fontName, size);
+}
@@ -10,6 +10,16 @@ void SceneUtils::addElement(const std::shared_ptr<Scene> &scene,
     assert(scene != nullptr);
     assert(element != nullptr);
 
+    if (scene->deferringChanges) {
+        auto elementInScene = findInIndex(scene, element->name);
+        if (!scene->commandBuffer.addElement(element, element->name, collisionLayer, elementInScene)) {
+            throw NameAlreadyExistsException("Element '" + element->name + "' already exists in scene!");
+        }
+        // the element may be used right away, only joining the element list waits for the flush
+        element->parentScene = scene;
+        return;
+    }
+
     if (hasElement(scene, element->name)) {
         throw NameAlreadyExistsException("Element '" + element->name + "' already exists in scene!");
     }
@@ -17,42 +27,46 @@ void SceneUtils::addElement(const std::shared_ptr<Scene> &scene,
     element->parentScene = scene;
     element->collisionLayer = collisionLayer;
     scene->elements.push_back(element);
+    scene->elementIndex[element->name] = element;
     scene->collisionLayers[collisionLayer].push_back(element);
+    scene->animationStates.markDirty();
+    scene->eventDispatcher.markDirty();
 }
 
 bool SceneUtils::hasElement(const std::shared_ptr<Scene> &scene, const std::string &name)
 {
     assert(scene != nullptr);
 
-    auto findByName = [&name](const std::shared_ptr<Element> &element) { return name == element->name; };
-
-    auto &elements = scene->elements;
-    auto result = std::find_if(elements.cbegin(), elements.cend(), findByName);
-    return result != elements.cend();
+    return findElement(scene, name) != nullptr;
 }
 
 std::shared_ptr<Element> SceneUtils::removeElement(const std::shared_ptr<Scene> &scene, const std::string &name)
 {
     assert(scene != nullptr);
 
-    auto findByName = [&name](const std::shared_ptr<Element> &element) { return name == element->name; };
-
-    auto &elements = scene->elements;
-    auto result = std::find_if(elements.cbegin(), elements.cend(), findByName);
+    if (scene->deferringChanges) {
+        auto element = scene->commandBuffer.removeElement(name, findInIndex(scene, name));
+        if (element == nullptr) {
+            throw NameNotFoundException("No element found with the name '" + name + "'!");
+        }
+        return element;
+    }
 
-    if (result == elements.cend()) {
+    auto element = findInIndex(scene, name);
+    if (element == nullptr) {
         throw NameNotFoundException("No element found with the name '" + name + "'!");
     }
 
-    auto element = *result;
-    auto &collisionLayer = scene->collisionLayers[element->collisionLayer];
-
-    auto resultCollisionLayer = std::find_if(collisionLayer.cbegin(), collisionLayer.cend(), findByName);
+    auto &elements = scene->elements;
+    auto result = std::find(elements.cbegin(), elements.cend(), element);
 
-    assert(resultCollisionLayer != collisionLayer.cend());
+    assert(result != elements.cend());
 
-    collisionLayer.erase(resultCollisionLayer);
+    eraseFromCollisionLayer(scene, element);
     elements.erase(result);
+    scene->elementIndex.erase(name);
+    scene->animationStates.markDirty();
+    scene->eventDispatcher.markDirty();
 
     return element;
 }
@@ -62,7 +76,17 @@ std::vector<std::shared_ptr<Element>> SceneUtils::removeAllElements(const std::s
     assert(scene != nullptr);
 
     auto elementsCopy = scene->elements;
+
+    if (scene->deferringChanges) {
+        scene->commandBuffer.removeAllElements();
+        return elementsCopy;
+    }
+
     scene->elements.clear();
+    scene->elementIndex.clear();
+    scene->collisionLayers.clear();
+    scene->animationStates.markDirty();
+    scene->eventDispatcher.markDirty();
     return elementsCopy;
 }
 
@@ -70,16 +94,12 @@ std::shared_ptr<Element> SceneUtils::getElement(const std::shared_ptr<Scene> &sc
 {
     assert(scene != nullptr);
 
-    auto findByName = [&name](const std::shared_ptr<Element> &element) { return name == element->name; };
-
-    auto &elements = scene->elements;
-    auto result = std::find_if(elements.cbegin(), elements.cend(), findByName);
-
-    if (result == elements.cend()) {
+    auto element = findElement(scene, name);
+    if (element == nullptr) {
         throw NameNotFoundException("No element found with the name '" + name + "'!");
     }
 
-    return *result;
+    return element;
 }
 
 std::vector<std::string> SceneUtils::getElementNames(const std::shared_ptr<Scene> &scene)
@@ -89,7 +109,7 @@ std::vector<std::string> SceneUtils::getElementNames(const std::shared_ptr<Scene
     auto getName = [](const std::shared_ptr<Element> &element) { return element->name; };
 
     std::vector<std::string> names;
-    auto &elements = scene->elements;
+    auto elements = getElements(scene);
     std::transform(elements.cbegin(), elements.cend(), std::back_inserter(names), getName);
     return names;
 }
@@ -98,6 +118,10 @@ uint32_t SceneUtils::getElementCount(const std::shared_ptr<Scene> &scene)
 {
     assert(scene != nullptr);
 
+    if (isDeferring(scene)) {
+        return getElements(scene).size();
+    }
+
     return scene->elements.size();
 }
 
@@ -106,7 +130,17 @@ std::vector<std::shared_ptr<Element>> SceneUtils::getCollisionLayer(const std::s
 {
     assert(scene != nullptr);
 
-    return scene->collisionLayers[collisionLayer];
+    auto result = scene->collisionLayers.find(collisionLayer);
+    std::vector<std::shared_ptr<Element>> layerInScene;
+    if (result != scene->collisionLayers.cend()) {
+        layerInScene = result->second;
+    }
+
+    if (isDeferring(scene)) {
+        return scene->commandBuffer.getCollisionLayer(collisionLayer, layerInScene, scene->elements);
+    }
+
+    return layerInScene;
 }
 
 std::vector<std::shared_ptr<Element>> SceneUtils::getCollisionLayerOfElement(const std::shared_ptr<Scene> &scene,
@@ -115,15 +149,21 @@ std::vector<std::shared_ptr<Element>> SceneUtils::getCollisionLayerOfElement(con
     assert(scene != nullptr);
     assert(element != nullptr);
 
+    uint32_t collisionLayer = element->collisionLayer;
+    if (isDeferring(scene)) {
+        collisionLayer = scene->commandBuffer.getCollisionLayerIndex(element->name, collisionLayer);
+    }
+
     auto otherThanElement = [&element](const std::shared_ptr<Element> &elementInLayer) {
         return element != elementInLayer;
     };
-    auto &collisionLayer = scene->collisionLayers[element->collisionLayer];
 
     std::vector<std::shared_ptr<Element>> elementsOtherThanElement;
-
-    std::copy_if(
-        collisionLayer.cbegin(), collisionLayer.cend(), std::back_inserter(elementsOtherThanElement), otherThanElement);
+    auto elementsInLayer = getCollisionLayer(scene, collisionLayer);
+    std::copy_if(elementsInLayer.cbegin(),
+                 elementsInLayer.cend(),
+                 std::back_inserter(elementsOtherThanElement),
+                 otherThanElement);
 
     return elementsOtherThanElement;
 }
@@ -134,24 +174,194 @@ void SceneUtils::moveElementToCollisionLayer(const std::shared_ptr<Scene> &scene
 {
     assert(scene != nullptr);
 
-    auto findByName = [&name](const std::shared_ptr<Element> &element) { return name == element->name; };
+    if (scene->deferringChanges) {
+        if (!scene->commandBuffer.moveElement(name, newCollisionLayer, findInIndex(scene, name))) {
+            throw NameNotFoundException("No element found with the name '" + name + "'!");
+        }
+        return;
+    }
+
+    auto element = findInIndex(scene, name);
+    if (element == nullptr) {
+        throw NameNotFoundException("No element found with the name '" + name + "'!");
+    }
+
+    eraseFromCollisionLayer(scene, element);
+
+    element->collisionLayer = newCollisionLayer;
+    scene->collisionLayers[newCollisionLayer].push_back(element);
+}
+
+void SceneUtils::applyDeferredChanges(const std::shared_ptr<Scene> &scene)
+{
+    assert(scene != nullptr);
+    assert(!scene->deferringChanges);
+
+    if (scene->commandBuffer.empty()) {
+        return;
+    }
+
+    auto &index = scene->elementIndex;
+    std::vector<std::shared_ptr<Element>> added;
+    std::unordered_set<Element *> removed;
+    std::unordered_set<Element *> moved;
+    bool allRemoved = false;
+
+    // the commands were validated while recording, only the name index is updated per command
+    for (auto &command : scene->commandBuffer.takeCommands()) {
+        switch (command.type) {
+            case SceneCommandType::ADD_ELEMENT:
+                command.element->parentScene = scene;
+                command.element->collisionLayer = command.collisionLayer;
+                index[command.name] = command.element;
+                added.push_back(command.element);
+                break;
+
+            case SceneCommandType::REMOVE_ELEMENT: {
+                auto result = index.find(command.name);
+                assert(result != index.end());
+
+                auto element = result->second;
+                index.erase(result);
+
+                auto addedResult = std::find(added.begin(), added.end(), element);
+                if (addedResult != added.end()) {
+                    added.erase(addedResult);
+                } else {
+                    removed.insert(element.get());
+                }
+                break;
+            }
+
+            case SceneCommandType::REMOVE_ALL_ELEMENTS:
+                index.clear();
+                added.clear();
+                moved.clear();
+                allRemoved = true;
+                break;
+
+            case SceneCommandType::MOVE_ELEMENT: {
+                auto result = index.find(command.name);
+                assert(result != index.end());
+
+                auto &element = result->second;
+                element->collisionLayer = command.collisionLayer;
+                if (std::find(added.cbegin(), added.cend(), element) == added.cend()) {
+                    moved.insert(element.get());
+                }
+                break;
+            }
+        }
+    }
 
     auto &elements = scene->elements;
-    auto result = std::find_if(elements.cbegin(), elements.cend(), findByName);
+    auto &collisionLayers = scene->collisionLayers;
+
+    if (allRemoved) {
+        elements.clear();
+        collisionLayers.clear();
+    } else if (!removed.empty() || !moved.empty()) {
+        auto isRemoved = [&removed](const std::shared_ptr<Element> &element) {
+            return removed.count(element.get()) > 0;
+        };
+        auto isRemovedOrMoved = [&removed, &moved](const std::shared_ptr<Element> &element) {
+            return removed.count(element.get()) > 0 || moved.count(element.get()) > 0;
+        };
+
+        elements.erase(std::remove_if(elements.begin(), elements.end(), isRemoved), elements.end());
+        for (auto &collisionLayer : collisionLayers) {
+            auto &layerElements = collisionLayer.second;
+            layerElements.erase(std::remove_if(layerElements.begin(), layerElements.end(), isRemovedOrMoved),
+                                layerElements.end());
+        }
+    }
 
-    if (result == elements.cend()) {
-        throw NameNotFoundException("No element found with the name '" + name + "'!");
+    // moved elements are re-added in scene order, which keeps the result deterministic
+    if (!moved.empty()) {
+        for (auto &element : elements) {
+            if (moved.count(element.get()) > 0) {
+                collisionLayers[element->collisionLayer].push_back(element);
+            }
+        }
     }
 
-    auto element = *result;
-    auto &collisionLayer = scene->collisionLayers[element->collisionLayer];
+    for (auto &element : added) {
+        elements.push_back(element);
+        collisionLayers[element->collisionLayer].push_back(element);
+    }
 
-    auto resultCollisionLayer = std::find_if(collisionLayer.cbegin(), collisionLayer.cend(), findByName);
+    if (allRemoved || !removed.empty() || !added.empty()) {
+        scene->animationStates.markDirty();
+        scene->eventDispatcher.markDirty();
+    }
+}
 
-    assert(resultCollisionLayer != collisionLayer.cend());
 
-    collisionLayer.erase(resultCollisionLayer);
+void SceneUtils::capturePointer(const std::shared_ptr<Scene> &scene, const std::shared_ptr<Element> &element)
+{
+    assert(scene != nullptr);
+    assert(element != nullptr);
 
-    element->collisionLayer = newCollisionLayer;
-    scene->collisionLayers[newCollisionLayer].push_back(element);
+    if (findInIndex(scene, element->name) != element) {
+        throw NameNotFoundException("Element '" + element->name + "' is not part of the scene!");
+    }
+    scene->pointerCapture = element;
 }
+
+void SceneUtils::releasePointer(const std::shared_ptr<Scene> &scene)
+{
+    assert(scene != nullptr);
+
+    scene->pointerCapture.reset();
+}
+
+std::shared_ptr<Element> SceneUtils::getPointerCapture(const std::shared_ptr<Scene> &scene)
+{
+    assert(scene != nullptr);
+
+    return scene->pointerCapture.lock();
+}
+
+std::shared_ptr<Element> SceneUtils::findInIndex(const std::shared_ptr<Scene> &scene, const std::string &name)
+{
+    auto result = scene->elementIndex.find(name);
+    if (result == scene->elementIndex.cend()) {
+        return nullptr;
+    }
+    return result->second;
+}
+
+std::shared_ptr<Element> SceneUtils::findElement(const std::shared_ptr<Scene> &scene, const std::string &name)
+{
+    auto element = findInIndex(scene, name);
+
+    if (isDeferring(scene)) {
+        return scene->commandBuffer.getElement(name, element);
+    }
+
+    return element;
+}
+
+std::vector<std::shared_ptr<Element>> SceneUtils::getElements(const std::shared_ptr<Scene> &scene)
+{
+    if (isDeferring(scene)) {
+        return scene->commandBuffer.getElements(scene->elements);
+    }
+
+    return scene->elements;
+}
+
+bool SceneUtils::isDeferring(const std::shared_ptr<Scene> &scene)
+{
+    return scene->deferringChanges && !scene->commandBuffer.empty();
+}
+
+void SceneUtils::eraseFromCollisionLayer(const std::shared_ptr<Scene> &scene, const std::shared_ptr<Element> &element)
+{
+    auto &collisionLayer = scene->collisionLayers[element->collisionLayer];
+    auto result = std::find(collisionLayer.cbegin(), collisionLayer.cend(), element);
+
+    assert(result != collisionLayer.cend());
+
+    collisionLayer.erase(result);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "interfaces/impl/NullFontInterface.h"
+
+using namespace bkengine;
+
+
+void NullTextTexture::onRender()
+{
+}
+
+
+void NullFontInterface::registerFont(const std::string &filePath, const std::string &fontName, double size)
+{
+}
+
+bool NullFontInterface::registerFontData(const AssetData &data, const std::string &fontName, double size)
+{
+    return true;
+}
+
+std::shared_ptr<TextTexture> NullFontInterface::renderFontToTexture(const std::string &text,
+                                                                    const std::string &fontName,
+                                                                    double size,
+                                                                    TextQuality)
+{
+    return std::make_shared<NullTextTexture>();
+}
@@ -0,0 +1,53 @@
+#include "interfaces/impl/NullGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+bool NullGraphicsInterface::initWindow(Size size, const std::string &title)
+{
+    windowSize = size;
+    windowTitle = title;
+    return true;
+}
+
+std::string NullGraphicsInterface::getLastError()
+{
+    return "";
+}
+
+void NullGraphicsInterface::setWindowSize(Size size)
+{
+    windowSize = size;
+}
+
+Size NullGraphicsInterface::getWindowSize()
+{
+    return windowSize;
+}
+
+void NullGraphicsInterface::setWindowTitle(const std::string &title)
+{
+    windowTitle = title;
+}
+
+std::string NullGraphicsInterface::getWindowTitle()
+{
+    return windowTitle;
+}
+
+void NullGraphicsInterface::delay(uint32_t)
+{
+}
+
+bool NullGraphicsInterface::setIcon(const std::string &)
+{
+    return true;
+}
+
+void NullGraphicsInterface::clear()
+{
+}
+
+void NullGraphicsInterface::draw()
+{
+}
@@ -0,0 +1,25 @@
+#include "interfaces/impl/NullImageInterface.h"
+
+using namespace bkengine;
+
+
+void NullImageTexture::onRender()
+{
+}
+
+std::shared_ptr<ImageTexture> NullImageTexture::clone() const
+{
+    return std::make_shared<NullImageTexture>(*this);
+}
+
+
+std::shared_ptr<ImageTexture> NullImageInterface::renderImageFileToTexture(const std::string &filePath,
+                                                                           const AbsRect &)
+{
+    return std::make_shared<NullImageTexture>();
+}
+
+std::shared_ptr<ImageTexture> NullImageInterface::renderImageDataToTexture(const AssetData &data, const AbsRect &)
+{
+    return std::make_shared<NullImageTexture>();
+}
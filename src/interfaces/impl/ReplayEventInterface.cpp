@@ -0,0 +1,57 @@
+#include "interfaces/impl/ReplayEventInterface.h"
+
+using namespace bkengine;
+
+
+void ReplayEventInterface::loadFromFile(const std::string &filename)
+{
+    setEvents(EventLog::load(filename));
+    Logger::info << "ReplayEventInterface::loadFromFile(const std::string &=" << filename << "): Read "
+                 << events.size() << " events";
+}
+
+void ReplayEventInterface::setEvents(const std::vector<RecordedEvent> &events)
+{
+    this->events = events;
+    next = 0;
+    frame = 0;
+    quitSent = false;
+}
+
+void ReplayEventInterface::beginFrame(uint64_t frame)
+{
+    if (frame < this->frame) {
+        next = 0;
+        quitSent = false;
+    }
+    this->frame = frame;
+}
+
+bool ReplayEventInterface::ready()
+{
+    if (next < events.size()) {
+        return events[next].frame <= frame;
+    }
+
+    bool endsWithQuit = !events.empty() && events.back().event.type == EventType::QUIT;
+    bool afterLastFrame = events.empty() || frame > events.back().frame;
+    return !endsWithQuit && !quitSent && afterLastFrame;
+}
+
+Event ReplayEventInterface::poll()
+{
+    if (next < events.size()) {
+        return events[next++].event;
+    }
+
+    quitSent = true;
+    Event event;
+    event.type = EventType::QUIT;
+    event.timestamp = Event::getTimestamp();
+    return event;
+}
+
+bool ReplayEventInterface::isFinished() const
+{
+    return next == events.size();
+}
@@ -0,0 +1,281 @@
+#include "utils/AssetArchive.h"
+#include "utils/Lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BKENGINE_HAS_MMAP
+#endif
+
+using namespace bkengine;
+
+
+namespace
+{
+    const char MAGIC[4] = {'B', 'K', 'P', 'A'};
+    const size_t HEADER_SIZE = 32;
+    const size_t INDEX_ENTRY_SIZE = 32;
+
+    uint64_t readNumber(const uint8_t *pointer, size_t bytes)
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(pointer[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    void writeNumber(std::ostream &output, uint64_t value, size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; ++i) {
+            output.put(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+    }
+}
+
+
+const uint32_t AssetArchive::VERSION;
+const uint32_t AssetArchive::ALIGNMENT;
+const uint32_t AssetArchive::FLAG_LZ4;
+
+std::shared_ptr<AssetArchive> AssetArchive::open(const std::string &filePath)
+{
+    auto archive = std::shared_ptr<AssetArchive>(new AssetArchive());
+    archive->filePath = filePath;
+
+#ifdef BKENGINE_HAS_MMAP
+    int descriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw ArchiveException("Archive '" + filePath + "' could not be opened!");
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        throw ArchiveException("Archive '" + filePath + "' could not be opened!");
+    }
+
+    archive->mappingSize = status.st_size;
+    if (archive->mappingSize > 0) {
+        void *mapping = mmap(nullptr, archive->mappingSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (mapping == MAP_FAILED) {
+            archive->mappingSize = 0;
+            throw ArchiveException("Archive '" + filePath + "' could not be mapped!");
+        }
+        archive->mapping = static_cast<const uint8_t *>(mapping);
+    } else {
+        ::close(descriptor);
+    }
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        throw ArchiveException("Archive '" + filePath + "' could not be opened!");
+    }
+    archive->buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    archive->mapping = archive->buffer.data();
+    archive->mappingSize = archive->buffer.size();
+#endif
+
+    archive->readIndex();
+    return archive;
+}
+
+AssetArchive::~AssetArchive()
+{
+#ifdef BKENGINE_HAS_MMAP
+    if (mapping != nullptr) {
+        munmap(const_cast<uint8_t *>(mapping), mappingSize);
+    }
+#endif
+}
+
+bool AssetArchive::hasEntry(const std::string &name) const
+{
+    return entries.find(name) != entries.cend();
+}
+
+const AssetArchive::Entry &AssetArchive::getEntry(const std::string &name) const
+{
+    auto result = entries.find(name);
+    if (result == entries.cend()) {
+        throw NameNotFoundException("No entry found with the name '" + name + "'!");
+    }
+    return result->second;
+}
+
+std::vector<std::string> AssetArchive::getEntryNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(entries.size());
+    for (auto &entry : entries) {
+        names.push_back(entry.first);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+AssetData AssetArchive::getData(const std::string &name) const
+{
+    auto &entry = getEntry(name);
+    const uint8_t *stored = mapping + entry.offset;
+
+    if ((entry.flags & FLAG_LZ4) == 0) {
+        return {stored, static_cast<size_t>(entry.size), shared_from_this()};
+    }
+
+    auto decompressed = std::make_shared<std::vector<uint8_t>>(entry.size);
+    if (!Lz4::decompress(stored, entry.storedSize, decompressed->data(), decompressed->size())) {
+        throw ArchiveException("Entry '" + name + "' of archive '" + filePath + "' is corrupt!");
+    }
+    return {decompressed->data(), decompressed->size(), decompressed};
+}
+
+std::string AssetArchive::getFilePath() const
+{
+    return filePath;
+}
+
+
+void AssetArchive::readIndex()
+{
+    if (mappingSize < HEADER_SIZE || std::memcmp(mapping, MAGIC, sizeof(MAGIC)) != 0) {
+        throw ArchiveException("'" + filePath + "' is not an asset archive!");
+    }
+
+    uint32_t version = readNumber(mapping + 4, 4);
+    if (version != VERSION) {
+        throw ArchiveException("Archive '" + filePath + "' has the unsupported version " + std::to_string(version) +
+                               "!");
+    }
+
+    uint64_t entryCount = readNumber(mapping + 8, 4);
+    uint64_t indexOffset = readNumber(mapping + 16, 8);
+    uint64_t indexSize = readNumber(mapping + 24, 8);
+    if (indexOffset > mappingSize || indexSize > mappingSize - indexOffset) {
+        throw ArchiveException("The index of archive '" + filePath + "' is corrupt!");
+    }
+
+    const uint8_t *position = mapping + indexOffset;
+    const uint8_t *end = position + indexSize;
+
+    for (uint64_t i = 0; i < entryCount; ++i) {
+        if (static_cast<size_t>(end - position) < INDEX_ENTRY_SIZE) {
+            throw ArchiveException("The index of archive '" + filePath + "' is corrupt!");
+        }
+
+        uint32_t nameLength = readNumber(position, 4);
+        Entry entry;
+        entry.flags = readNumber(position + 4, 4);
+        entry.offset = readNumber(position + 8, 8);
+        entry.storedSize = readNumber(position + 16, 8);
+        entry.size = readNumber(position + 24, 8);
+        position += INDEX_ENTRY_SIZE;
+
+        // compressed sizes are bounded, so a corrupt index cannot request arbitrary allocations
+        bool sizeValid = (entry.flags & FLAG_LZ4) != 0 ? entry.size <= Lz4::getMaxDecompressedSize(entry.storedSize)
+                                                       : entry.storedSize == entry.size;
+        if (static_cast<size_t>(end - position) < nameLength || entry.offset > mappingSize ||
+            entry.storedSize > mappingSize - entry.offset || !sizeValid) {
+            throw ArchiveException("The index of archive '" + filePath + "' is corrupt!");
+        }
+
+        std::string name(reinterpret_cast<const char *>(position), nameLength);
+        position += nameLength;
+        entries[name] = entry;
+    }
+}
+
+
+AssetArchiveWriter &
+AssetArchiveWriter::addEntry(const std::string &name, const std::vector<uint8_t> &data, bool compress)
+{
+    auto sameName = [&name](const PendingEntry &entry) { return entry.name == name; };
+    if (std::find_if(pendingEntries.cbegin(), pendingEntries.cend(), sameName) != pendingEntries.cend()) {
+        throw NameAlreadyExistsException("Entry '" + name + "' already exists in archive!");
+    }
+
+    PendingEntry entry = {name, data, data.size(), 0};
+
+    if (compress && !data.empty()) {
+        std::vector<uint8_t> compressed(Lz4::getMaxCompressedSize(data.size()));
+        compressed.resize(Lz4::compress(data.data(), data.size(), compressed.data()));
+
+        // incompressible data is stored as is
+        if (compressed.size() < data.size()) {
+            entry.data = std::move(compressed);
+            entry.flags = AssetArchive::FLAG_LZ4;
+        }
+    }
+
+    pendingEntries.push_back(std::move(entry));
+    return *this;
+}
+
+AssetArchiveWriter &AssetArchiveWriter::addFile(const std::string &name, const std::string &filePath, bool compress)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        throw ArchiveException("File '" + filePath + "' could not be opened!");
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return addEntry(name, data, compress);
+}
+
+void AssetArchiveWriter::write(const std::string &filePath) const
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw ArchiveException("Archive '" + filePath + "' could not be created!");
+    }
+
+    // the header is written last, once the index position is known
+    std::vector<char> header(HEADER_SIZE, 0);
+    file.write(header.data(), header.size());
+
+    std::vector<uint64_t> offsets;
+    uint64_t position = HEADER_SIZE;
+    for (auto &entry : pendingEntries) {
+        uint64_t padding = (AssetArchive::ALIGNMENT - position % AssetArchive::ALIGNMENT) % AssetArchive::ALIGNMENT;
+        for (uint64_t i = 0; i < padding; ++i) {
+            file.put(0);
+        }
+        position += padding;
+
+        offsets.push_back(position);
+        file.write(reinterpret_cast<const char *>(entry.data.data()), entry.data.size());
+        position += entry.data.size();
+    }
+
+    uint64_t indexOffset = position;
+    for (size_t i = 0; i < pendingEntries.size(); ++i) {
+        auto &entry = pendingEntries[i];
+        writeNumber(file, entry.name.size(), 4);
+        writeNumber(file, entry.flags, 4);
+        writeNumber(file, offsets[i], 8);
+        writeNumber(file, entry.data.size(), 8);
+        writeNumber(file, entry.size, 8);
+        file.write(entry.name.data(), entry.name.size());
+        position += INDEX_ENTRY_SIZE + entry.name.size();
+    }
+
+    file.seekp(0);
+    file.write(MAGIC, sizeof(MAGIC));
+    writeNumber(file, AssetArchive::VERSION, 4);
+    writeNumber(file, pendingEntries.size(), 4);
+    writeNumber(file, 0, 4);
+    writeNumber(file, indexOffset, 8);
+    writeNumber(file, position - indexOffset, 8);
+
+    if (!file) {
+        throw ArchiveException("Archive '" + filePath + "' could not be written!");
+    }
+}
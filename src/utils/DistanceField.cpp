@@ -0,0 +1,106 @@
+#include "utils/DistanceField.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace bkengine;
+
+
+std::vector<uint8_t>
+DistanceField::generate(const uint8_t *coverage, uint32_t width, uint32_t height, uint32_t spread)
+{
+    uint32_t fieldWidth = width + 2 * spread;
+    uint32_t fieldHeight = height + 2 * spread;
+    size_t size = static_cast<size_t>(fieldWidth) * fieldHeight;
+
+    std::vector<bool> inside(size, false);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            inside[(y + spread) * fieldWidth + x + spread] = coverage[y * width + x] >= 128;
+        }
+    }
+
+    // distances of outside cells to the shape and of inside cells to the background
+    std::vector<double> toInside(size), toOutside(size);
+    for (size_t i = 0; i < size; ++i) {
+        toInside[i] = inside[i] ? 0 : getInfinity();
+        toOutside[i] = inside[i] ? getInfinity() : 0;
+    }
+    transform(toInside, fieldWidth, fieldHeight);
+    transform(toOutside, fieldWidth, fieldHeight);
+
+    std::vector<uint8_t> field(size);
+    for (size_t i = 0; i < size; ++i) {
+        // cell centers are half a pixel away from the outline between neighbouring cells
+        double distance = inside[i] ? std::sqrt(toOutside[i]) - 0.5 : 0.5 - std::sqrt(toInside[i]);
+        double value = 128 + distance * 127 / std::max(spread, 1u);
+        field[i] = static_cast<uint8_t>(std::min(std::max(std::round(value), 0.0), 255.0));
+    }
+    return field;
+}
+
+void DistanceField::transform(std::vector<double> &grid, uint32_t width, uint32_t height)
+{
+    size_t length = std::max(width, height);
+    std::vector<double> input(length), output(length), bounds(length + 1);
+    std::vector<size_t> vertices(length);
+
+    for (uint32_t x = 0; x < width; ++x) {
+        for (uint32_t y = 0; y < height; ++y) {
+            input[y] = grid[y * width + x];
+        }
+        transform(input.data(), height, output.data(), vertices.data(), bounds.data());
+        for (uint32_t y = 0; y < height; ++y) {
+            grid[y * width + x] = output[y];
+        }
+    }
+
+    for (uint32_t y = 0; y < height; ++y) {
+        transform(&grid[y * width], width, output.data(), vertices.data(), bounds.data());
+        std::copy(output.begin(), output.begin() + width, grid.begin() + y * width);
+    }
+}
+
+double DistanceField::getInfinity()
+{
+    return 1e20;
+}
+
+
+void DistanceField::transform(const double *input, size_t size, double *output, size_t *vertices, double *bounds)
+{
+    if (size == 0) {
+        return;
+    }
+
+    // lower envelope of the parabolas rooted at every cell
+    auto intersection = [input](size_t q, size_t p) {
+        double qd = static_cast<double>(q), pd = static_cast<double>(p);
+        return ((input[q] + qd * qd) - (input[p] + pd * pd)) / (2 * qd - 2 * pd);
+    };
+
+    size_t k = 0;
+    vertices[0] = 0;
+    bounds[0] = -getInfinity();
+    bounds[1] = getInfinity();
+    for (size_t q = 1; q < size; ++q) {
+        double s = intersection(q, vertices[k]);
+        while (s <= bounds[k]) {
+            --k;
+            s = intersection(q, vertices[k]);
+        }
+        ++k;
+        vertices[k] = q;
+        bounds[k] = s;
+        bounds[k + 1] = getInfinity();
+    }
+
+    k = 0;
+    for (size_t q = 0; q < size; ++q) {
+        while (bounds[k + 1] < q) {
+            ++k;
+        }
+        double offset = static_cast<double>(q) - static_cast<double>(vertices[k]);
+        output[q] = offset * offset + input[vertices[k]];
+    }
+}
@@ -0,0 +1,83 @@
+#include "utils/EventCoalescer.h"
+
+using namespace bkengine;
+
+
+const size_t EventCoalescer::TYPE_COUNT;
+
+bool EventCoalescer::isCoalescible(EventType type)
+{
+    return type == EventType::MOTION || type == EventType::WHEEL;
+}
+
+void EventCoalescer::setCoalescing(EventType type, bool enabled)
+{
+    coalescing[static_cast<size_t>(type)] = enabled && isCoalescible(type);
+}
+
+bool EventCoalescer::isCoalescing(EventType type) const
+{
+    return coalescing[static_cast<size_t>(type)];
+}
+
+bool EventCoalescer::isEnabled() const
+{
+    return isCoalescing(EventType::MOTION) || isCoalescing(EventType::WHEEL);
+}
+
+bool EventCoalescer::add(const Event &event, Event &completed)
+{
+    if (hasPending) {
+        if (merge(event)) {
+            return false;
+        }
+
+        // the new event waits for the next call, even if it cannot be merged itself, to keep the order
+        completed = pending;
+        pending = event;
+        return true;
+    }
+
+    if (isCoalescing(event.type)) {
+        pending = event;
+        hasPending = true;
+        return false;
+    }
+
+    completed = event;
+    return true;
+}
+
+bool EventCoalescer::flush(Event &completed)
+{
+    if (!hasPending) {
+        return false;
+    }
+
+    completed = pending;
+    hasPending = false;
+    return true;
+}
+
+bool EventCoalescer::merge(const Event &event)
+{
+    if (event.type != pending.type || event.windowId != pending.windowId || !isCoalescing(event.type)) {
+        return false;
+    }
+
+    if (event.type == EventType::MOTION) {
+        pending.motion.x = event.motion.x;
+        pending.motion.y = event.motion.y;
+        pending.motion.relativeX += event.motion.relativeX;
+        pending.motion.relativeY += event.motion.relativeY;
+    } else {
+        if (event.wheel.direction != pending.wheel.direction) {
+            return false;
+        }
+        pending.wheel.x += event.wheel.x;
+        pending.wheel.y += event.wheel.y;
+    }
+
+    pending.timestamp = event.timestamp;
+    return true;
+}
@@ -0,0 +1,293 @@
+#include "utils/EventLog.h"
+
+#include <algorithm>
+
+using namespace bkengine;
+
+
+namespace
+{
+    const char MAGIC[4] = {'B', 'K', 'E', 'L'};
+    const uint32_t VERSION = 1;
+
+    enum class ReadResult
+    {
+        OK,
+        // the file ended before the first byte
+        END,
+        // the file ended in the middle
+        TRUNCATED,
+        CORRUPT
+    };
+
+    void writeFixed(std::ostream &output, uint64_t value, size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; ++i) {
+            output.put(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+    }
+
+    bool readFixed(std::istream &input, size_t bytes, uint64_t &value)
+    {
+        value = 0;
+        for (size_t i = 0; i < bytes; ++i) {
+            int byte = input.get();
+            if (byte == std::char_traits<char>::eof()) {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte) << (8 * i);
+        }
+        return true;
+    }
+
+    // 7 bits per byte, the high bit marks a following byte
+    void writeVarint(std::ostream &output, uint64_t value)
+    {
+        while (value >= 0x80) {
+            output.put(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        output.put(static_cast<char>(value));
+    }
+
+    ReadResult readVarint(std::istream &input, uint64_t &value)
+    {
+        value = 0;
+        for (size_t shift = 0; shift < 64; shift += 7) {
+            int byte = input.get();
+            if (byte == std::char_traits<char>::eof()) {
+                return shift == 0 ? ReadResult::END : ReadResult::TRUNCATED;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return ReadResult::OK;
+            }
+        }
+        return ReadResult::CORRUPT;
+    }
+
+    void writeInt32(std::ostream &output, int32_t value)
+    {
+        writeFixed(output, static_cast<uint32_t>(value), 4);
+    }
+
+    bool readInt32(std::istream &input, int32_t &value)
+    {
+        uint64_t raw;
+        if (!readFixed(input, 4, raw)) {
+            return false;
+        }
+        value = static_cast<int32_t>(static_cast<uint32_t>(raw));
+        return true;
+    }
+
+    // false for truncated records and values out of the range of their enum
+    bool readFields(std::istream &input, EventType type, Event &event)
+    {
+        uint64_t a, b, c;
+        switch (type) {
+            case EventType::KEYBOARD:
+                if (!readFixed(input, 2, a) || !readFixed(input, 1, b) || !readFixed(input, 1, c)
+                        || b > static_cast<uint64_t>(KeyState::UP)) {
+                    return false;
+                }
+                event.keyboard = {Keys::fromCode(static_cast<uint16_t>(a)), static_cast<KeyState>(b), c != 0};
+                return true;
+
+            case EventType::MOUSE:
+                if (!readFixed(input, 1, a) || !readFixed(input, 2, b) || !readFixed(input, 2, c)
+                        || !readInt32(input, event.mouse.x) || !readInt32(input, event.mouse.y)
+                        || a > static_cast<uint64_t>(ButtonState::UP)) {
+                    return false;
+                }
+                event.mouse.state = static_cast<ButtonState>(a);
+                event.mouse.button = Buttons::fromCode(static_cast<uint16_t>(b));
+                event.mouse.specialId = static_cast<uint8_t>(c & 0xff);
+                event.mouse.clicks = static_cast<uint8_t>(c >> 8);
+                return true;
+
+            case EventType::MOTION:
+                return readInt32(input, event.motion.x) && readInt32(input, event.motion.y)
+                       && readInt32(input, event.motion.relativeX) && readInt32(input, event.motion.relativeY);
+
+            case EventType::WHEEL:
+                if (!readInt32(input, event.wheel.x) || !readInt32(input, event.wheel.y) || !readFixed(input, 1, a)
+                        || a > static_cast<uint64_t>(WheelDirection::FLIPPED)) {
+                    return false;
+                }
+                event.wheel.direction = static_cast<WheelDirection>(a);
+                return true;
+
+            case EventType::WINDOW:
+                if (!readFixed(input, 1, a) || !readInt32(input, event.window.data1)
+                        || !readInt32(input, event.window.data2)
+                        || a > static_cast<uint64_t>(WindowEventType::TAKE_FOCUS)) {
+                    return false;
+                }
+                event.window.type = static_cast<WindowEventType>(a);
+                return true;
+
+            case EventType::UNKNOWN:
+            case EventType::QUIT:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    ReadResult readEvent(std::istream &input, EventType type, Event &event)
+    {
+        if (readFields(input, type, event)) {
+            return ReadResult::OK;
+        }
+        // short reads hit the end of the file, everything else is out of range
+        return input.eof() ? ReadResult::TRUNCATED : ReadResult::CORRUPT;
+    }
+}
+
+
+EventRecorder::EventRecorder(const std::string &filePath)
+    : filePath(filePath), file(filePath, std::ios::binary | std::ios::trunc)
+{
+    if (!file) {
+        throw EventLogException("Event log '" + filePath + "' could not be created!");
+    }
+
+    file.write(MAGIC, sizeof(MAGIC));
+    writeFixed(file, VERSION, 4);
+}
+
+void EventRecorder::record(uint64_t frame, const Event &event)
+{
+    writeVarint(file, frame - lastFrame);
+    file.put(static_cast<char>(event.type));
+    writeVarint(file, event.timestamp);
+    writeVarint(file, event.windowId);
+
+    switch (event.type) {
+        case EventType::KEYBOARD:
+            writeFixed(file, event.keyboard.key.getCode(), 2);
+            writeFixed(file, static_cast<uint8_t>(event.keyboard.state), 1);
+            writeFixed(file, event.keyboard.repeat ? 1 : 0, 1);
+            break;
+
+        case EventType::MOUSE:
+            writeFixed(file, static_cast<uint8_t>(event.mouse.state), 1);
+            writeFixed(file, event.mouse.button.getCode(), 2);
+            writeFixed(file, event.mouse.specialId | (event.mouse.clicks << 8), 2);
+            writeInt32(file, event.mouse.x);
+            writeInt32(file, event.mouse.y);
+            break;
+
+        case EventType::MOTION:
+            writeInt32(file, event.motion.x);
+            writeInt32(file, event.motion.y);
+            writeInt32(file, event.motion.relativeX);
+            writeInt32(file, event.motion.relativeY);
+            break;
+
+        case EventType::WHEEL:
+            writeInt32(file, event.wheel.x);
+            writeInt32(file, event.wheel.y);
+            writeFixed(file, static_cast<uint8_t>(event.wheel.direction), 1);
+            break;
+
+        case EventType::WINDOW:
+            writeFixed(file, static_cast<uint8_t>(event.window.type), 1);
+            writeInt32(file, event.window.data1);
+            writeInt32(file, event.window.data2);
+            break;
+
+        default:
+            break;
+    }
+
+    lastFrame = frame;
+    ++count;
+}
+
+void EventRecorder::flush()
+{
+    if (flushedCount == count) {
+        return;
+    }
+
+    flushedCount = count;
+    file.flush();
+    if (!file) {
+        throw EventLogException("Event log '" + filePath + "' could not be written!");
+    }
+}
+
+uint64_t EventRecorder::getCount() const
+{
+    return count;
+}
+
+const std::string &EventRecorder::getFilePath() const
+{
+    return filePath;
+}
+
+
+std::vector<RecordedEvent> EventLog::load(const std::string &filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        throw EventLogException("Event log '" + filePath + "' could not be opened!");
+    }
+
+    char magic[sizeof(MAGIC)];
+    uint64_t version;
+    if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)
+            || !readFixed(file, 4, version)) {
+        throw EventLogException("'" + filePath + "' is not an event log!");
+    }
+    if (version != VERSION) {
+        throw EventLogException("Event log '" + filePath + "' has the unsupported version " + std::to_string(version)
+                                + "!");
+    }
+
+    // inside a record the end of the file means it is truncated as well
+    auto fail = [&filePath](ReadResult result) {
+        if (result == ReadResult::CORRUPT) {
+            throw EventLogException("Event log '" + filePath + "' is corrupt!");
+        }
+        throw EventLogException("Event log '" + filePath + "' is truncated!");
+    };
+
+    std::vector<RecordedEvent> events;
+    uint64_t frame = 0;
+    uint64_t delta;
+    ReadResult result;
+    while ((result = readVarint(file, delta)) != ReadResult::END) {
+        if (result != ReadResult::OK) {
+            fail(result);
+        }
+
+        RecordedEvent recorded;
+        frame += delta;
+        recorded.frame = frame;
+
+        int type = file.get();
+        uint64_t windowId;
+        if (type == std::char_traits<char>::eof()) {
+            fail(ReadResult::TRUNCATED);
+        }
+        if ((result = readVarint(file, recorded.event.timestamp)) != ReadResult::OK
+                || (result = readVarint(file, windowId)) != ReadResult::OK) {
+            fail(result);
+        }
+        if (type > static_cast<int>(EventType::WINDOW)) {
+            fail(ReadResult::CORRUPT);
+        }
+        if ((result = readEvent(file, static_cast<EventType>(type), recorded.event)) != ReadResult::OK) {
+            fail(result);
+        }
+        recorded.event.type = static_cast<EventType>(type);
+        recorded.event.windowId = static_cast<uint32_t>(windowId);
+        events.push_back(recorded);
+    }
+    return events;
+}
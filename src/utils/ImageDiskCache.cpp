@@ -0,0 +1,141 @@
+#include "utils/ImageDiskCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace bkengine;
+
+
+namespace
+{
+    const char MAGIC[4] = {'B', 'K', 'D', 'I'};
+    const uint32_t VERSION = 1;
+
+    void writeNumber(std::ostream &output, uint32_t value)
+    {
+        for (size_t i = 0; i < 4; ++i) {
+            output.put(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+    }
+
+    bool readNumber(std::istream &input, uint32_t &value)
+    {
+        unsigned char bytes[4];
+        if (!input.read(reinterpret_cast<char *>(bytes), sizeof(bytes))) {
+            return false;
+        }
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+}
+
+
+void DecodedImage::premultiplyAlpha()
+{
+    for (size_t i = 0; i + 3 < pixels.size(); i += 4) {
+        uint32_t alpha = pixels[i + 3];
+        for (size_t channel = 0; channel < 3; ++channel) {
+            pixels[i + channel] = static_cast<uint8_t>((pixels[i + channel] * alpha + 127) / 255);
+        }
+    }
+}
+
+
+ImageDiskCache::ImageDiskCache(const std::string &directory) : directory(directory)
+{
+}
+
+uint64_t ImageDiskCache::hash(const uint8_t *data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool ImageDiskCache::load(uint64_t hash, DecodedImage &image) const
+{
+    std::ifstream file(getFilePath(hash), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version, width, height;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !readNumber(file, version) || version != VERSION || !readNumber(file, width) || !readNumber(file, height)) {
+        return false;
+    }
+
+    // a truncated or corrupt entry is a miss, its header must not decide how much is allocated
+    auto headerEnd = file.tellg();
+    file.seekg(0, std::ios::end);
+    uint64_t remaining = static_cast<uint64_t>(file.tellg() - headerEnd);
+    if (!file || remaining != static_cast<uint64_t>(width) * height * 4) {
+        return false;
+    }
+    file.seekg(headerEnd);
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(remaining));
+    if (!file.read(reinterpret_cast<char *>(pixels.data()), pixels.size())) {
+        return false;
+    }
+
+    image.width = width;
+    image.height = height;
+    image.pixels = std::move(pixels);
+    return true;
+}
+
+bool ImageDiskCache::store(uint64_t hash, const DecodedImage &image) const
+{
+    if (image.pixels.size() != static_cast<size_t>(image.width) * image.height * 4) {
+        return false;
+    }
+
+    std::string filePath = getFilePath(hash);
+    std::ostringstream temporaryPath;
+    temporaryPath << filePath << "." << std::this_thread::get_id() << ".tmp";
+
+    {
+        std::ofstream file(temporaryPath.str(), std::ios::binary | std::ios::trunc);
+        file.write(MAGIC, sizeof(MAGIC));
+        writeNumber(file, VERSION);
+        writeNumber(file, image.width);
+        writeNumber(file, image.height);
+        file.write(reinterpret_cast<const char *>(image.pixels.data()), image.pixels.size());
+
+        if (!file) {
+            std::remove(temporaryPath.str().c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(temporaryPath.str().c_str(), filePath.c_str()) != 0) {
+        std::remove(temporaryPath.str().c_str());
+        return false;
+    }
+    return true;
+}
+
+void ImageDiskCache::remove(uint64_t hash) const
+{
+    std::remove(getFilePath(hash).c_str());
+}
+
+std::string ImageDiskCache::getDirectory() const
+{
+    return directory;
+}
+
+std::string ImageDiskCache::getFilePath(uint64_t hash) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bkdi", static_cast<unsigned long long>(hash));
+    return directory + "/" + name;
+}
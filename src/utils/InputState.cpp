@@ -0,0 +1,142 @@
+#include "utils/InputState.h"
+
+using namespace bkengine;
+
+
+void InputState::beginFrame()
+{
+    previousKeys = currentKeys;
+    pressedKeys.reset();
+    releasedKeys.reset();
+
+    previousButtons = currentButtons;
+    pressedButtons.reset();
+    releasedButtons.reset();
+
+    mouseMotion = {0, 0};
+    wheelMotion = {0, 0};
+}
+
+void InputState::update(const Event &event)
+{
+    switch (event.type) {
+        case EventType::KEYBOARD: {
+            size_t code = event.keyboard.key.getCode();
+            if (code >= Keys::COUNT || event.keyboard.repeat) {
+                break;
+            }
+
+            if (event.keyboard.state == KeyState::DOWN) {
+                currentKeys.set(code);
+                pressedKeys.set(code);
+            } else if (event.keyboard.state == KeyState::UP) {
+                currentKeys.reset(code);
+                releasedKeys.set(code);
+            }
+            break;
+        }
+
+        case EventType::MOUSE: {
+            size_t code = event.mouse.button.getCode();
+            mousePosition = {static_cast<double>(event.mouse.x), static_cast<double>(event.mouse.y)};
+            if (code >= Buttons::COUNT) {
+                break;
+            }
+
+            if (event.mouse.state == ButtonState::DOWN) {
+                currentButtons.set(code);
+                pressedButtons.set(code);
+            } else if (event.mouse.state == ButtonState::UP) {
+                currentButtons.reset(code);
+                releasedButtons.set(code);
+            }
+            break;
+        }
+
+        case EventType::MOTION:
+            mousePosition = {static_cast<double>(event.motion.x), static_cast<double>(event.motion.y)};
+            mouseMotion.x += event.motion.relativeX;
+            mouseMotion.y += event.motion.relativeY;
+            break;
+
+        case EventType::WHEEL: {
+            int32_t sign = event.wheel.direction == WheelDirection::FLIPPED ? -1 : 1;
+            wheelMotion.x += sign * event.wheel.x;
+            wheelMotion.y += sign * event.wheel.y;
+            break;
+        }
+
+        case EventType::WINDOW:
+            if (event.window.type == WindowEventType::FOCUS_LOST) {
+                reset();
+            }
+            break;
+
+        case EventType::UNKNOWN:
+        case EventType::QUIT:
+            break;
+    }
+}
+
+void InputState::reset()
+{
+    releasedKeys |= currentKeys;
+    currentKeys.reset();
+    releasedButtons |= currentButtons;
+    currentButtons.reset();
+}
+
+bool InputState::isDown(const Key &key) const
+{
+    return key.getCode() < Keys::COUNT && currentKeys.test(key.getCode());
+}
+
+bool InputState::wasDown(const Key &key) const
+{
+    return key.getCode() < Keys::COUNT && previousKeys.test(key.getCode());
+}
+
+bool InputState::wasPressed(const Key &key) const
+{
+    return key.getCode() < Keys::COUNT && pressedKeys.test(key.getCode());
+}
+
+bool InputState::wasReleased(const Key &key) const
+{
+    return key.getCode() < Keys::COUNT && releasedKeys.test(key.getCode());
+}
+
+bool InputState::isDown(const Button &button) const
+{
+    return button.getCode() < Buttons::COUNT && currentButtons.test(button.getCode());
+}
+
+bool InputState::wasDown(const Button &button) const
+{
+    return button.getCode() < Buttons::COUNT && previousButtons.test(button.getCode());
+}
+
+bool InputState::wasPressed(const Button &button) const
+{
+    return button.getCode() < Buttons::COUNT && pressedButtons.test(button.getCode());
+}
+
+bool InputState::wasReleased(const Button &button) const
+{
+    return button.getCode() < Buttons::COUNT && releasedButtons.test(button.getCode());
+}
+
+Point InputState::getMousePosition() const
+{
+    return mousePosition;
+}
+
+Point InputState::getMouseMotion() const
+{
+    return mouseMotion;
+}
+
+Point InputState::getWheelMotion() const
+{
+    return wheelMotion;
+}
@@ -0,0 +1,297 @@
+#include "utils/JobSystem.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    struct WorkerContext
+    {
+        const JobSystem *system;
+        uint32_t index;
+    };
+
+    thread_local WorkerContext currentWorker = {nullptr, 0};
+}
+
+
+bool JobCounter::isDone() const
+{
+    return count.load(std::memory_order_acquire) == 0;
+}
+
+uint32_t JobCounter::getCount() const
+{
+    return count.load(std::memory_order_acquire);
+}
+
+
+JobSystem::JobSystem(uint32_t workerCount) : workerCount(workerCount)
+{
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+
+    for (auto &worker : workers) {
+        if (worker->thread.get_id() == std::this_thread::get_id()) {
+            // the last reference was dropped inside a job, the worker leaves its loop once the job returns
+            currentWorker = {nullptr, 0};
+            worker->thread.detach();
+        } else if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    for (auto &worker : workers) {
+        while (Job *job = worker->queue.pop()) {
+            delete job;
+        }
+    }
+
+    for (Job *job : injectionQueue) {
+        delete job;
+    }
+
+    for (Job *job : backgroundQueue) {
+        delete job;
+    }
+}
+
+uint32_t JobSystem::getDefaultWorkerCount()
+{
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+uint32_t JobSystem::getWorkerCount() const
+{
+    return workerCount;
+}
+
+bool JobSystem::isWorkerThread() const
+{
+    return currentWorker.system == this;
+}
+
+void JobSystem::submit(const std::function<void()> &function, JobCounter *counter)
+{
+    if (counter != nullptr) {
+        counter->count.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    push(new Job{function, counter});
+}
+
+void JobSystem::submitBackground(const std::function<void()> &function, JobCounter *counter)
+{
+    if (counter != nullptr) {
+        counter->count.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    push(new Job{function, counter}, true);
+}
+
+void JobSystem::submitAfter(JobCounter &dependency, const std::function<void()> &function, JobCounter *counter)
+{
+    if (counter != nullptr) {
+        counter->count.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    Job *job = new Job{function, counter};
+
+    {
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if (!dependency.isDone()) {
+            dependency.continuations.push_back(job);
+            return;
+        }
+    }
+
+    push(job);
+}
+
+void JobSystem::wait(JobCounter &counter)
+{
+    while (!counter.isDone()) {
+        Job *job = findJob(&counter);
+        if (job != nullptr) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // the last finishing job might still hold the lock
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(counter.mutex);
+        std::swap(exception, counter.exception);
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+
+void JobSystem::start()
+{
+    workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(new Worker());
+    }
+
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+    }
+}
+
+void JobSystem::workerLoop(uint32_t index)
+{
+    currentWorker = {this, index};
+
+    while (!stopping) {
+        Job *job = findJob(nullptr);
+        if (job != nullptr) {
+            execute(job);
+            if (currentWorker.system != this) {
+                return;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() { return stopping || pendingJobs.load() > 0; });
+        lock.unlock();
+
+        // a job may be announced before it is visible in a queue
+        std::this_thread::yield();
+    }
+}
+
+void JobSystem::push(Job *job, bool background)
+{
+    if (workerCount == 0) {
+        execute(job);
+        return;
+    }
+
+    std::call_once(startFlag, &JobSystem::start, this);
+
+    pendingJobs.fetch_add(1);
+
+    if (background) {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        backgroundQueue.push_back(job);
+    } else if (!isWorkerThread() || !workers[currentWorker.index]->queue.push(job)) {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        injectionQueue.push_back(job);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCondition.notify_one();
+}
+
+Job *JobSystem::findJob(const JobCounter *waitedCounter)
+{
+    if (workerCount == 0) {
+        return nullptr;
+    }
+
+    std::call_once(startFlag, &JobSystem::start, this);
+
+    uint32_t start = 0;
+    Job *job = nullptr;
+
+    if (isWorkerThread()) {
+        start = currentWorker.index + 1;
+        job = workers[currentWorker.index]->queue.pop();
+    }
+
+    if (job == nullptr) {
+        job = takeFromQueue(injectionQueue);
+    }
+
+    for (uint32_t i = 0; i < workerCount && job == nullptr; ++i) {
+        job = workers[(start + i) % workerCount]->queue.steal();
+    }
+
+    // idle workers take any background job, waiting threads only the ones they wait for
+    if (job == nullptr) {
+        job = takeFromQueue(backgroundQueue, waitedCounter);
+    }
+
+    if (job != nullptr) {
+        pendingJobs.fetch_sub(1);
+    }
+
+    return job;
+}
+
+Job *JobSystem::takeFromQueue(std::deque<Job *> &queue, const JobCounter *counter)
+{
+    std::lock_guard<std::mutex> lock(injectionMutex);
+
+    auto hasCounter = [counter](const Job *job) { return job->counter == counter; };
+    auto result = counter == nullptr ? queue.begin() : std::find_if(queue.begin(), queue.end(), hasCounter);
+    if (result == queue.end()) {
+        return nullptr;
+    }
+
+    Job *job = *result;
+    queue.erase(result);
+    return job;
+}
+
+void JobSystem::execute(Job *job)
+{
+    std::unique_ptr<Job> ownedJob(job);
+    bool onWorker = isWorkerThread();
+
+    if (ownedJob->counter == nullptr) {
+        ownedJob->function();
+        return;
+    }
+
+    std::exception_ptr exception;
+    try {
+        ownedJob->function();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    if (onWorker && currentWorker.system != this) {
+        // the job destroyed the system, nobody can wait on its counter anymore
+        return;
+    }
+
+    finish(ownedJob->counter, exception);
+}
+
+void JobSystem::finish(JobCounter *counter, std::exception_ptr exception)
+{
+    std::vector<Job *> continuations;
+
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (exception && !counter->exception) {
+            counter->exception = exception;
+        }
+
+        if (counter->count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::swap(continuations, counter->continuations);
+        }
+    }
+
+    for (Job *continuation : continuations) {
+        push(continuation);
+    }
+}
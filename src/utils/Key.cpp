@@ -1,71 +1,36 @@
 #include "utils/Key.h"
+#include "utils/Keys.h"
 
 using namespace bkengine;
 
 
-Key::Key() : Key("UNKNOWN")
-{
-}
-
-Key::Key(const std::string &keyString) : keyString(keyString)
-{
-}
-
-bool Key::operator==(const Key &key) const
-{
-    return keyString == key.keyString;
-}
-
-bool Key::operator!=(const Key &key) const
-{
-    return !(key == *this);
-}
-
 Key::operator const std::string() const
 {
-    return keyString;
+    return toString();
 }
 
 Key::operator const char *() const
 {
-    return keyString.c_str();
+    return Keys::getName(*this);
 }
 
 std::string Key::toString() const
 {
-    return keyString;
+    return Keys::getName(*this);
 }
 
 
-Button::Button() : Button("UNKNOWN")
-{
-}
-
-Button::Button(const std::string &buttonString) : buttonString(buttonString)
-{
-}
-
-bool Button::operator==(const Button &button) const
-{
-    return buttonString == button.buttonString;
-}
-
-bool Button::operator!=(const Button &button) const
-{
-    return !(button == *this);
-}
-
 Button::operator const std::string() const
 {
-    return buttonString;
+    return toString();
 }
 
 Button::operator const char *() const
 {
-    return buttonString.c_str();
+    return Buttons::getName(*this);
 }
 
 std::string Button::toString() const
 {
-    return buttonString;
-}
\ No newline at end of file
+    return Buttons::getName(*this);
+}
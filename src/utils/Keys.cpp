@@ -3,148 +3,196 @@
 using namespace bkengine;
 
 
-Key Keys::UNKNOWN("UNKNOWN");
+namespace
+{
+    // names in the order of the key and button codes
+    constexpr const char *KEY_NAMES[] = {"UNKNOWN", "RETURN", "ESCAPE", "BACKSPACE", "TAB", "SPACE", "CAPSLOCK",
+                                         "ZERO", "ONE", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT",
+                                         "NINE", "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N",
+                                         "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z", "F1", "F2", "F3",
+                                         "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12", "F13", "F14", "F15",
+                                         "F16", "F17", "F18", "F19", "F20", "F21", "F22", "F23", "F24", "RIGHT",
+                                         "LEFT", "DOWN", "UP", "PRINTSCREEN", "SCROLLLOCK", "PAUSE", "INSERT", "HOME",
+                                         "PAGEUP", "DELETE", "END", "PAGEDOWN", "NUMLOCKCLEAR", "NP_DIVIDE",
+                                         "NP_MULTIPLY", "NP_MINUS", "NP_PLUS", "NP_ENTER", "NP_ONE", "NP_TWO",
+                                         "NP_THREE", "NP_FOUR", "NP_FIVE", "NP_SIX", "NP_SEVEN", "NP_EIGHT",
+                                         "NP_NINE", "NP_ZERO", "NP_SEPARATOR", "LCTRL", "LSHIFT", "LALT", "LGUI",
+                                         "RCTRL", "RSHIFT", "RALT", "RGUI", "MUTE", "VOLUMEUP", "VOLUMEDOWN",
+                                         "AUDIONEXT", "AUDIOPREV", "AUDIOSTOP", "AUDIOPLAY", "AUDIOMUTE",
+                                         "APPLICATION", "MENU", "BRIGHTNESSDOWN", "BRIGHTNESSUP", "SLEEP", "POWER"};
+    constexpr const char *BUTTON_NAMES[] = {"UNKNOWN", "LEFT", "RIGHT", "MIDDLE", "SPECIAL"};
+
+    static_assert(sizeof(KEY_NAMES) / sizeof(KEY_NAMES[0]) == Keys::COUNT, "every key needs a name");
+    static_assert(sizeof(BUTTON_NAMES) / sizeof(BUTTON_NAMES[0]) == Buttons::COUNT, "every button needs a name");
+}
+
+const uint16_t Keys::COUNT;
+const uint16_t Buttons::COUNT;
+
+
+constexpr Key Keys::UNKNOWN;
 
 /* Control keys */
-Key Keys::RETURN("RETURN");
-Key Keys::ESCAPE("ESCAPE");
-Key Keys::BACKSPACE("BACKSPACE");
-Key Keys::TAB("TAB");
-Key Keys::SPACE("SPACE");
-Key Keys::CAPSLOCK("CAPSLOCK");
+constexpr Key Keys::RETURN;
+constexpr Key Keys::ESCAPE;
+constexpr Key Keys::BACKSPACE;
+constexpr Key Keys::TAB;
+constexpr Key Keys::SPACE;
+constexpr Key Keys::CAPSLOCK;
 
 /* Number keys */
-Key Keys::ZERO("ZERO");
-Key Keys::ONE("ONE");
-Key Keys::TWO("TWO");
-Key Keys::THREE("THREE");
-Key Keys::FOUR("FOUR");
-Key Keys::FIVE("FIVE");
-Key Keys::SIX("SIX");
-Key Keys::SEVEN("SEVEN");
-Key Keys::EIGHT("EIGHT");
-Key Keys::NINE("NINE");
+constexpr Key Keys::ZERO;
+constexpr Key Keys::ONE;
+constexpr Key Keys::TWO;
+constexpr Key Keys::THREE;
+constexpr Key Keys::FOUR;
+constexpr Key Keys::FIVE;
+constexpr Key Keys::SIX;
+constexpr Key Keys::SEVEN;
+constexpr Key Keys::EIGHT;
+constexpr Key Keys::NINE;
 
 /* Letter keys */
-Key Keys::A("A");
-Key Keys::B("B");
-Key Keys::C("C");
-Key Keys::D("D");
-Key Keys::E("E");
-Key Keys::F("F");
-Key Keys::G("G");
-Key Keys::H("H");
-Key Keys::I("I");
-Key Keys::J("J");
-Key Keys::K("K");
-Key Keys::L("L");
-Key Keys::M("M");
-Key Keys::N("N");
-Key Keys::O("O");
-Key Keys::P("P");
-Key Keys::Q("Q");
-Key Keys::R("R");
-Key Keys::S("S");
-Key Keys::T("T");
-Key Keys::U("U");
-Key Keys::V("V");
-Key Keys::W("W");
-Key Keys::X("X");
-Key Keys::Y("Y");
-Key Keys::Z("Z");
+constexpr Key Keys::A;
+constexpr Key Keys::B;
+constexpr Key Keys::C;
+constexpr Key Keys::D;
+constexpr Key Keys::E;
+constexpr Key Keys::F;
+constexpr Key Keys::G;
+constexpr Key Keys::H;
+constexpr Key Keys::I;
+constexpr Key Keys::J;
+constexpr Key Keys::K;
+constexpr Key Keys::L;
+constexpr Key Keys::M;
+constexpr Key Keys::N;
+constexpr Key Keys::O;
+constexpr Key Keys::P;
+constexpr Key Keys::Q;
+constexpr Key Keys::R;
+constexpr Key Keys::S;
+constexpr Key Keys::T;
+constexpr Key Keys::U;
+constexpr Key Keys::V;
+constexpr Key Keys::W;
+constexpr Key Keys::X;
+constexpr Key Keys::Y;
+constexpr Key Keys::Z;
 
 /* Function keys */
-Key Keys::F1("F1");
-Key Keys::F2("F2");
-Key Keys::F3("F3");
-Key Keys::F4("F4");
-Key Keys::F5("F5");
-Key Keys::F6("F6");
-Key Keys::F7("F7");
-Key Keys::F8("F8");
-Key Keys::F9("F9");
-Key Keys::F10("F10");
-Key Keys::F11("F11");
-Key Keys::F12("F12");
-Key Keys::F13("F13");
-Key Keys::F14("F14");
-Key Keys::F15("F15");
-Key Keys::F16("F16");
-Key Keys::F17("F17");
-Key Keys::F18("F18");
-Key Keys::F19("F19");
-Key Keys::F20("F20");
-Key Keys::F21("F21");
-Key Keys::F22("F22");
-Key Keys::F23("F23");
-Key Keys::F24("F24");
+constexpr Key Keys::F1;
+constexpr Key Keys::F2;
+constexpr Key Keys::F3;
+constexpr Key Keys::F4;
+constexpr Key Keys::F5;
+constexpr Key Keys::F6;
+constexpr Key Keys::F7;
+constexpr Key Keys::F8;
+constexpr Key Keys::F9;
+constexpr Key Keys::F10;
+constexpr Key Keys::F11;
+constexpr Key Keys::F12;
+constexpr Key Keys::F13;
+constexpr Key Keys::F14;
+constexpr Key Keys::F15;
+constexpr Key Keys::F16;
+constexpr Key Keys::F17;
+constexpr Key Keys::F18;
+constexpr Key Keys::F19;
+constexpr Key Keys::F20;
+constexpr Key Keys::F21;
+constexpr Key Keys::F22;
+constexpr Key Keys::F23;
+constexpr Key Keys::F24;
 
 /* Arrow keys */
-Key Keys::RIGHT("RIGHT");
-Key Keys::LEFT("LEFT");
-Key Keys::DOWN("DOWN");
-Key Keys::UP("UP");
-
-Key Keys::PRINTSCREEN("PRINTSCREEN");
-Key Keys::SCROLLLOCK("SCROLLLOCK");
-Key Keys::PAUSE("PAUSE");
-Key Keys::INSERT("INSERT");
-Key Keys::HOME("HOME");
-Key Keys::PAGEUP("PAGEUP");
-Key Keys::DELETE("DELETE");
-Key Keys::END("END");
-Key Keys::PAGEDOWN("PAGEDOWN");
+constexpr Key Keys::RIGHT;
+constexpr Key Keys::LEFT;
+constexpr Key Keys::DOWN;
+constexpr Key Keys::UP;
+
+constexpr Key Keys::PRINTSCREEN;
+constexpr Key Keys::SCROLLLOCK;
+constexpr Key Keys::PAUSE;
+constexpr Key Keys::INSERT;
+constexpr Key Keys::HOME;
+constexpr Key Keys::PAGEUP;
+constexpr Key Keys::DELETE;
+constexpr Key Keys::END;
+constexpr Key Keys::PAGEDOWN;
 
 /* Numpad keys */
-Key Keys::NUMLOCKCLEAR("NUMLOCKCLEAR");
-Key Keys::NP_DIVIDE("NP_DIVIDE");
-Key Keys::NP_MULTIPLY("NP_MULTIPLY");
-Key Keys::NP_MINUS("NP_MINUS");
-Key Keys::NP_PLUS("NP_PLUS");
-Key Keys::NP_ENTER("NP_ENTER");
-Key Keys::NP_ONE("NP_ONE");
-Key Keys::NP_TWO("NP_TWO");
-Key Keys::NP_THREE("NP_THREE");
-Key Keys::NP_FOUR("NP_FOUR");
-Key Keys::NP_FIVE("NP_FIVE");
-Key Keys::NP_SIX("NP_SIX");
-Key Keys::NP_SEVEN("NP_SEVEN");
-Key Keys::NP_EIGHT("NP_EIGHT");
-Key Keys::NP_NINE("NP_NINE");
-Key Keys::NP_ZERO("NP_ZERO");
-Key Keys::NP_SEPARATOR("NP_SEPARATOR");
+constexpr Key Keys::NUMLOCKCLEAR;
+constexpr Key Keys::NP_DIVIDE;
+constexpr Key Keys::NP_MULTIPLY;
+constexpr Key Keys::NP_MINUS;
+constexpr Key Keys::NP_PLUS;
+constexpr Key Keys::NP_ENTER;
+constexpr Key Keys::NP_ONE;
+constexpr Key Keys::NP_TWO;
+constexpr Key Keys::NP_THREE;
+constexpr Key Keys::NP_FOUR;
+constexpr Key Keys::NP_FIVE;
+constexpr Key Keys::NP_SIX;
+constexpr Key Keys::NP_SEVEN;
+constexpr Key Keys::NP_EIGHT;
+constexpr Key Keys::NP_NINE;
+constexpr Key Keys::NP_ZERO;
+constexpr Key Keys::NP_SEPARATOR;
 
 /* Modifier keys */
-Key Keys::LCTRL("LCTRL");
-Key Keys::LSHIFT("LSHIFT");
-Key Keys::LALT("LALT");
-Key Keys::LGUI("LGUI");
-Key Keys::RCTRL("RCTRL");
-Key Keys::RSHIFT("RSHIFT");
-Key Keys::RALT("RALT");
-Key Keys::RGUI("RGUI");
+constexpr Key Keys::LCTRL;
+constexpr Key Keys::LSHIFT;
+constexpr Key Keys::LALT;
+constexpr Key Keys::LGUI;
+constexpr Key Keys::RCTRL;
+constexpr Key Keys::RSHIFT;
+constexpr Key Keys::RALT;
+constexpr Key Keys::RGUI;
 
 /* Media keys */
-Key Keys::MUTE("MUTE");
-Key Keys::VOLUMEUP("VOLUMEUP");
-Key Keys::VOLUMEDOWN("VOLUMEDOWN");
-Key Keys::AUDIONEXT("AUDIONEXT");
-Key Keys::AUDIOPREV("AUDIOPREV");
-Key Keys::AUDIOSTOP("AUDIOSTOP");
-Key Keys::AUDIOPLAY("AUDIOPLAY");
-Key Keys::AUDIOMUTE("AUDIOMUTE");
+constexpr Key Keys::MUTE;
+constexpr Key Keys::VOLUMEUP;
+constexpr Key Keys::VOLUMEDOWN;
+constexpr Key Keys::AUDIONEXT;
+constexpr Key Keys::AUDIOPREV;
+constexpr Key Keys::AUDIOSTOP;
+constexpr Key Keys::AUDIOPLAY;
+constexpr Key Keys::AUDIOMUTE;
 
 /* Special keys */
-Key Keys::APPLICATION("APPLICATION");
-Key Keys::MENU("MENU");
-Key Keys::BRIGHTNESSDOWN("BRIGHTNESSDOWN");
-Key Keys::BRIGHTNESSUP("BRIGHTNESSUP");
-Key Keys::SLEEP("SLEEP");
-Key Keys::POWER("POWER");
-
-
-Button Buttons::UNKNOWN("UNKNOWN");
-Button Buttons::LEFT("LEFT");
-Button Buttons::RIGHT("RIGHT");
-Button Buttons::MIDDLE("MIDDLE");
-Button Buttons::SPECIAL("SPECIAL");
+constexpr Key Keys::APPLICATION;
+constexpr Key Keys::MENU;
+constexpr Key Keys::BRIGHTNESSDOWN;
+constexpr Key Keys::BRIGHTNESSUP;
+constexpr Key Keys::SLEEP;
+constexpr Key Keys::POWER;
+
+
+constexpr Button Buttons::UNKNOWN;
+constexpr Button Buttons::LEFT;
+constexpr Button Buttons::RIGHT;
+constexpr Button Buttons::MIDDLE;
+constexpr Button Buttons::SPECIAL;
+
+
+const char *Keys::getName(const Key &key)
+{
+    return key.getCode() < COUNT ? KEY_NAMES[key.getCode()] : KEY_NAMES[0];
+}
+
+const char *Buttons::getName(const Button &button)
+{
+    return button.getCode() < COUNT ? BUTTON_NAMES[button.getCode()] : BUTTON_NAMES[0];
+}
+
+Key Keys::fromCode(uint16_t code)
+{
+    return code < COUNT ? Key(code) : UNKNOWN;
+}
+
+Button Buttons::fromCode(uint16_t code)
+{
+    return code < COUNT ? Button(code) : UNKNOWN;
+}
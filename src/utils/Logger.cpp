@@ -1,5 +1,18 @@
 #include "utils/Logger.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "utils/SpscQueue.h"
+
 using namespace bkengine;
 
 
@@ -12,12 +25,12 @@ Logger Logger::debug;
 Logger::StaticConstructor Logger::_;
 std::mutex Logger::loggerMutex;
 int Logger::logLevel = 4;
-bool Logger::useColors;
+std::atomic<bool> Logger::useColors;
+std::ostream *Logger::output = &std::cout;
 
 
-static std::string GetTimeString()
+static std::string GetTimeString(time_t t)
 {
-    time_t t = time(0);
     struct tm *now = localtime(&t);
     int year = now->tm_year + 1900;
     int month = now->tm_mon + 1;
@@ -35,50 +48,362 @@ static std::string GetTimeString()
     return ss.str();
 }
 
+static const char *GetLevelColor(LogLevel level)
+{
+    switch (level) {
+        case LogLevel::FATAL:
+            return RED;
+            
+        case LogLevel::ERROR:
+            return MAG;
+            
+        case LogLevel::WARNING:
+            return YEL;
+            
+        case LogLevel::INFO:
+            return GRN;
+            
+        case LogLevel::DEBUG:
+            return BLU;
+            
+        case LogLevel::NOTHING:
+        default:
+            return "";
+    }
+}
 
-int Logger::LoggerStreamBuf::sync()
+static const char *GetLevelName(LogLevel level)
 {
-    loggerMutex.lock();
+    switch (level) {
+        case LogLevel::FATAL:
+            return "FATAL";
+            
+        case LogLevel::ERROR:
+            return "ERROR";
+            
+        case LogLevel::WARNING:
+            return "WARNING";
+            
+        case LogLevel::INFO:
+            return "INFO";
+            
+        case LogLevel::DEBUG:
+            return "DEBUG";
+            
+        case LogLevel::NOTHING:
+        default:
+            return "NOTHING";
+    }
+}
+
+static void WriteMessage(std::ostream &output,
+                         LogLevel level,
+                         const std::string &timeString,
+                         const char *message,
+                         size_t length,
+                         bool colors)
+{
+    if (colors) {
+        output << GetLevelColor(level);
+    }
     
-    if (Logger::IsSet(logger->level)) {
-        if (useColors) {
-            switch (logger->level) {
-                case LogLevel::FATAL:
-                    output << RED;
-                    break;
-                    
-                case LogLevel::ERROR:
-                    output << MAG;
-                    break;
-                    
-                case LogLevel::WARNING:
-                    output << YEL;
-                    break;
-                    
-                case LogLevel::INFO:
-                    output << GRN;
-                    break;
-                    
-                case LogLevel::DEBUG:
-                    output << BLU;
-                    break;
-                    
-                case LogLevel::NOTHING:
-                default:
-                    break;
+    output << timeString << "[" << GetLevelName(level) << "] ";
+    output.write(message, length);
+    
+    if (colors) {
+        output << NRM;
+    }
+}
+
+
+namespace
+{
+    /** part of a flushed message, long messages are split into several records */
+    struct LogRecord
+    {
+        static const size_t TEXT_SIZE = 232;
+        
+        time_t time;
+        LogLevel level;
+        uint16_t length;
+        bool continued;
+        char text[TEXT_SIZE];
+    };
+    
+    const size_t LogRecord::TEXT_SIZE;
+    
+    struct ThreadLog
+    {
+        static const size_t CAPACITY = 1024;
+        // longer messages are truncated, so a message always fits into an empty buffer
+        static const size_t MAX_RECORDS = 16;
+        
+        SpscQueue<LogRecord> records{CAPACITY};
+        // only used by the writer, collects the records of a message popped in different batches
+        std::string partial;
+    };
+    
+    const size_t ThreadLog::CAPACITY;
+    const size_t ThreadLog::MAX_RECORDS;
+}
+
+
+/**
+    Buffers of all threads which logged in async mode and the writer thread draining them.
+    Producers only touch the registry once, when their thread logs the first message.
+*/
+class Logger::AsyncBackend
+{
+public:
+    static AsyncBackend &Get()
+    {
+        // never destroyed, the loggers outlive it and are still used by the destructors of other statics
+        static AsyncBackend *backend = Create();
+        return *backend;
+    }
+    
+    void Start()
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        if (!running) {
+            running = true;
+            writer = std::thread(&AsyncBackend::Run, this);
+        }
+    }
+    
+    void Stop()
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        if (running) {
+            running = false;
+            writer.join();
+            // messages of threads which saw the backend running just before
+            while (pushing > 0) {
+                std::this_thread::yield();
             }
+            Drain();
+        }
+    }
+    
+    bool IsRunning() const
+    {
+        return running;
+    }
+    
+    /** returns false if the backend is not running, the message has to be written synchronously then */
+    bool Push(LogLevel level, time_t time, const std::string &message)
+    {
+        // announced before checking running, so Stop() waits for the message before its final drain
+        ++pushing;
+        if (!running) {
+            --pushing;
+            return false;
         }
         
-        output << GetTimeString() << "[" << prefix << "] " << str();
+        static thread_local std::shared_ptr<ThreadLog> threadLog = Register();
         
-        if (useColors) {
-            output << NRM;
+        LogRecord records[ThreadLog::MAX_RECORDS];
+        size_t length = std::min(message.size(), ThreadLog::MAX_RECORDS * LogRecord::TEXT_SIZE);
+        size_t count = std::max<size_t>((length + LogRecord::TEXT_SIZE - 1) / LogRecord::TEXT_SIZE, 1);
+        for (size_t i = 0; i < count; ++i) {
+            size_t offset = i * LogRecord::TEXT_SIZE;
+            records[i].time = time;
+            records[i].level = level;
+            records[i].length = static_cast<uint16_t>(std::min(length - offset, LogRecord::TEXT_SIZE));
+            records[i].continued = i + 1 < count;
+            std::memcpy(records[i].text, message.data() + offset, records[i].length);
         }
         
-        output << std::flush;
-        str("");
+        // a message is pushed completely or not at all
+        auto &queue = threadLog->records;
+        if (queue.getCapacity() - queue.size() < count) {
+            ++dropped;
+        } else {
+            queue.push(records, count);
+            ++pushed;
+        }
+        --pushing;
+        return true;
+    }
+    
+    void Flush()
+    {
+        uint64_t target = pushed;
+        while (running && written < target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    
+    uint64_t GetDroppedCount() const
+    {
+        return dropped;
     }
     
+private:
+    AsyncBackend() = default;
+    
+    static AsyncBackend *Create()
+    {
+        // runs before the destructors of the statics constructed earlier, the writer is joined while they exist
+        std::atexit(&AsyncBackend::StopAtExit);
+        return new AsyncBackend();
+    }
+    
+    static void StopAtExit()
+    {
+        Get().Stop();
+    }
+    
+    std::shared_ptr<ThreadLog> Register()
+    {
+        auto threadLog = std::make_shared<ThreadLog>();
+        std::lock_guard<std::mutex> lock(logsMutex);
+        logs.push_back(threadLog);
+        return threadLog;
+    }
+    
+    void Run()
+    {
+        while (running) {
+            if (Drain() == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+    
+    // writes every complete message buffered so far with a single flush
+    size_t Drain()
+    {
+        std::vector<std::shared_ptr<ThreadLog>> current;
+        {
+            std::lock_guard<std::mutex> lock(logsMutex);
+            // buffers of exited threads are only referenced here and can go once they are empty
+            logs.erase(std::remove_if(logs.begin(), logs.end(),
+                                      [](const std::shared_ptr<ThreadLog> &log) {
+                                          return log.use_count() == 1 && log->records.empty();
+                                      }),
+                       logs.end());
+            current = logs;
+        }
+        
+        std::string batch;
+        size_t messages = 0;
+        for (auto &log : current) {
+            size_t count;
+            while ((count = log->records.pop(records, BATCH_SIZE)) > 0) {
+                for (size_t i = 0; i < count; ++i) {
+                    const LogRecord &record = records[i];
+                    log->partial.append(record.text, record.length);
+                    if (record.continued) {
+                        continue;
+                    }
+                    
+                    if (record.time != lastTime) {
+                        lastTime = record.time;
+                        timeString = GetTimeString(record.time);
+                    }
+                    
+                    std::ostringstream formatted;
+                    WriteMessage(formatted, record.level, timeString, log->partial.data(), log->partial.size(),
+                                 useColors);
+                    batch += formatted.str();
+                    log->partial.clear();
+                    ++messages;
+                }
+            }
+        }
+        
+        if (messages > 0) {
+            std::lock_guard<std::mutex> lock(loggerMutex);
+            output->write(batch.data(), batch.size());
+            *output << std::flush;
+        }
+        written += messages;
+        return messages;
+    }
+    
+    static const size_t BATCH_SIZE = 64;
+    
+    std::mutex threadMutex;
+    std::atomic<bool> running{false};
+    std::thread writer;
+    std::atomic<uint32_t> pushing{0};
+    
+    std::mutex logsMutex;
+    std::vector<std::shared_ptr<ThreadLog>> logs;
+    
+    std::atomic<uint64_t> pushed{0};
+    std::atomic<uint64_t> written{0};
+    std::atomic<uint64_t> dropped{0};
+    
+    // only used by the writer
+    LogRecord records[BATCH_SIZE];
+    time_t lastTime = 0;
+    std::string timeString;
+};
+
+const size_t Logger::AsyncBackend::BATCH_SIZE;
+
+
+std::string &Logger::LoggerStreamBuf::GetMessage()
+{
+    // one pending message per thread and level, so threads logging at once do not mix their messages
+    static thread_local std::string messages[6];
+    
+    switch (logger->level) {
+        case LogLevel::DEBUG:
+            return messages[1];
+            
+        case LogLevel::INFO:
+            return messages[2];
+            
+        case LogLevel::WARNING:
+            return messages[3];
+            
+        case LogLevel::ERROR:
+            return messages[4];
+            
+        case LogLevel::FATAL:
+            return messages[5];
+            
+        case LogLevel::NOTHING:
+        default:
+            return messages[0];
+    }
+}
+
+int Logger::LoggerStreamBuf::overflow(int character)
+{
+    if (character != traits_type::eof()) {
+        GetMessage().push_back(static_cast<char>(character));
+    }
+    return traits_type::not_eof(character);
+}
+
+std::streamsize Logger::LoggerStreamBuf::xsputn(const char *characters, std::streamsize count)
+{
+    GetMessage().append(characters, static_cast<size_t>(count));
+    return count;
+}
+
+int Logger::LoggerStreamBuf::sync()
+{
+    if (!Logger::IsSet(logger->level)) {
+        return 0;
+    }
+    
+    std::string &message = GetMessage();
+    if (AsyncBackend::Get().Push(logger->level, time(0), message)) {
+        message.clear();
+        return 0;
+    }
+    
+    loggerMutex.lock();
+    
+    WriteMessage(*output, logger->level, GetTimeString(time(0)), message.data(), message.size(), useColors);
+    *output << std::flush;
+    message.clear();
+    
     loggerMutex.unlock();
     return 0;
 }
@@ -110,32 +435,6 @@ Logger::Logger(LogLevel level) : std::ostream(&buffer)
 void Logger::SetInternalLevel(LogLevel level)
 {
     this->level = level;
-    std::string prefix;
-    
-    switch (level) {
-        case LogLevel::FATAL:
-            prefix = "FATAL";
-            break;
-            
-        case LogLevel::ERROR:
-            prefix = "ERROR";
-            break;
-            
-        case LogLevel::WARNING:
-            prefix = "WARNING";
-            break;
-            
-        case LogLevel::INFO:
-            prefix = "INFO";
-            break;
-            
-        case LogLevel::NOTHING:
-        default:
-            prefix = "NOTHING";
-            break;
-    }
-    
-    buffer.SetPrefix(prefix);
 }
 
 
@@ -157,4 +456,34 @@ bool Logger::IsSet(LogLevel level)
 void Logger::UseColors(bool colors)
 {
     useColors = colors;
-}
\ No newline at end of file
+}
+
+void Logger::SetOutput(std::ostream &stream)
+{
+    std::lock_guard<std::mutex> lock(loggerMutex);
+    output = &stream;
+}
+
+void Logger::UseAsync(bool async)
+{
+    if (async) {
+        AsyncBackend::Get().Start();
+    } else {
+        AsyncBackend::Get().Stop();
+    }
+}
+
+bool Logger::IsAsync()
+{
+    return AsyncBackend::Get().IsRunning();
+}
+
+void Logger::Flush()
+{
+    AsyncBackend::Get().Flush();
+}
+
+uint64_t Logger::GetDroppedCount()
+{
+    return AsyncBackend::Get().GetDroppedCount();
+}
@@ -0,0 +1,189 @@
+#include "utils/Lz4.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace bkengine;
+
+
+namespace
+{
+    const size_t MIN_MATCH = 4;
+    // the format requires the last 5 bytes to be literals and the last match to start 12 bytes before the end
+    const size_t LAST_LITERALS = 5;
+    const size_t MATCH_FIND_LIMIT = 12;
+    const size_t MAX_OFFSET = 65535;
+    const uint32_t HASH_BITS = 12;
+
+    uint32_t read32(const uint8_t *pointer)
+    {
+        uint32_t value;
+        std::memcpy(&value, pointer, sizeof(value));
+        return value;
+    }
+
+    uint32_t hash(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    uint8_t *writeLength(uint8_t *output, size_t length)
+    {
+        while (length >= 255) {
+            *output++ = 255;
+            length -= 255;
+        }
+        *output++ = static_cast<uint8_t>(length);
+        return output;
+    }
+
+    uint8_t *writeSequence(
+        uint8_t *output, const uint8_t *literals, size_t literalLength, size_t offset, size_t matchLength)
+    {
+        uint8_t *token = output++;
+        *token = 0;
+
+        if (literalLength >= 15) {
+            *token = 15 << 4;
+            output = writeLength(output, literalLength - 15);
+        } else {
+            *token = static_cast<uint8_t>(literalLength << 4);
+        }
+
+        std::memcpy(output, literals, literalLength);
+        output += literalLength;
+
+        if (matchLength == 0) {
+            return output;
+        }
+
+        *output++ = static_cast<uint8_t>(offset & 0xff);
+        *output++ = static_cast<uint8_t>(offset >> 8);
+
+        size_t length = matchLength - MIN_MATCH;
+        if (length >= 15) {
+            *token |= 15;
+            output = writeLength(output, length - 15);
+        } else {
+            *token |= static_cast<uint8_t>(length);
+        }
+        return output;
+    }
+
+    bool readLength(const uint8_t *&input, const uint8_t *end, size_t &length)
+    {
+        uint8_t value;
+        do {
+            if (input >= end) {
+                return false;
+            }
+            value = *input++;
+            length += value;
+        } while (value == 255);
+        return true;
+    }
+}
+
+
+size_t Lz4::getMaxCompressedSize(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+uint64_t Lz4::getMaxDecompressedSize(uint64_t compressedSize)
+{
+    // every length byte of 255 expands to 255 bytes, nothing expands further
+    return compressedSize * 255;
+}
+
+size_t Lz4::compress(const uint8_t *source, size_t size, uint8_t *destination)
+{
+    uint8_t *output = destination;
+    size_t anchor = 0;
+
+    if (size > MATCH_FIND_LIMIT) {
+        std::vector<int64_t> table(1 << HASH_BITS, -1);
+        size_t matchLimit = size - LAST_LITERALS;
+        size_t position = 0;
+
+        while (position < size - MATCH_FIND_LIMIT) {
+            uint32_t sequence = read32(source + position);
+            uint32_t index = hash(sequence);
+            int64_t candidate = table[index];
+            table[index] = static_cast<int64_t>(position);
+
+            if (candidate < 0 || position - candidate > MAX_OFFSET || read32(source + candidate) != sequence) {
+                position++;
+                continue;
+            }
+
+            size_t length = MIN_MATCH;
+            while (position + length < matchLimit && source[candidate + length] == source[position + length]) {
+                length++;
+            }
+
+            output = writeSequence(output, source + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor = position;
+        }
+    }
+
+    output = writeSequence(output, source + anchor, size - anchor, 0, 0);
+    return output - destination;
+}
+
+bool Lz4::decompress(const uint8_t *source, size_t compressedSize, uint8_t *destination, size_t size)
+{
+    const uint8_t *input = source;
+    const uint8_t *inputEnd = source + compressedSize;
+    uint8_t *output = destination;
+    uint8_t *outputEnd = destination + size;
+
+    while (input < inputEnd) {
+        uint8_t token = *input++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(input, inputEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(inputEnd - input) ||
+            literalLength > static_cast<size_t>(outputEnd - output)) {
+            return false;
+        }
+        std::memcpy(output, input, literalLength);
+        input += literalLength;
+        output += literalLength;
+
+        // the last sequence has no match
+        if (input == inputEnd) {
+            break;
+        }
+
+        if (inputEnd - input < 2) {
+            return false;
+        }
+        size_t offset = input[0] | (input[1] << 8);
+        input += 2;
+        if (offset == 0 || offset > static_cast<size_t>(output - destination)) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(input, inputEnd, matchLength)) {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > static_cast<size_t>(outputEnd - output)) {
+            return false;
+        }
+
+        // byte-wise copy, matches may overlap their own output
+        const uint8_t *match = output - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            output[i] = match[i];
+        }
+        output += matchLength;
+    }
+
+    return output == outputEnd;
+}
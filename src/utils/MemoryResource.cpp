@@ -0,0 +1,125 @@
+#include "utils/MemoryResource.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class NewDeleteResource : public MemoryResource
+    {
+    protected:
+        void *doAllocate(size_t bytes, size_t alignment) override
+        {
+            return ::operator new(bytes);
+        }
+
+        void doDeallocate(void *pointer, size_t bytes, size_t alignment) override
+        {
+            ::operator delete(pointer);
+        }
+    };
+}
+
+
+void *MemoryResource::allocate(size_t bytes, size_t alignment)
+{
+    return doAllocate(bytes, alignment);
+}
+
+void MemoryResource::deallocate(void *pointer, size_t bytes, size_t alignment)
+{
+    doDeallocate(pointer, bytes, alignment);
+}
+
+bool MemoryResource::isEqual(const MemoryResource &other) const noexcept
+{
+    return doIsEqual(other);
+}
+
+bool MemoryResource::doIsEqual(const MemoryResource &other) const noexcept
+{
+    return this == &other;
+}
+
+
+std::shared_ptr<MemoryResource> bkengine::getDefaultMemoryResource()
+{
+    static auto resource = new std::shared_ptr<MemoryResource>(std::make_shared<NewDeleteResource>());
+    return *resource;
+}
+
+
+MonotonicBufferResource::MonotonicBufferResource(size_t initialSize, const std::shared_ptr<MemoryResource> &upstream)
+    : upstream(upstream), nextChunkSize(initialSize > 0 ? initialSize : 1024)
+{
+}
+
+MonotonicBufferResource::~MonotonicBufferResource()
+{
+    release();
+}
+
+void MonotonicBufferResource::release()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &chunk : chunks) {
+        upstream->deallocate(chunk.memory, chunk.size);
+    }
+
+    chunks.clear();
+    current = nullptr;
+    remaining = 0;
+    allocatedBytes = 0;
+}
+
+size_t MonotonicBufferResource::getAllocatedBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return allocatedBytes;
+}
+
+size_t MonotonicBufferResource::getChunkCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return chunks.size();
+}
+
+void *MonotonicBufferResource::doAllocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    size_t padding = (alignment - reinterpret_cast<uintptr_t>(current) % alignment) % alignment;
+
+    if (current == nullptr || padding + bytes > remaining) {
+        addChunk(bytes + alignment);
+        padding = (alignment - reinterpret_cast<uintptr_t>(current) % alignment) % alignment;
+    }
+
+    void *memory = current + padding;
+    current += padding + bytes;
+    remaining -= padding + bytes;
+    allocatedBytes += bytes;
+    return memory;
+}
+
+void MonotonicBufferResource::doDeallocate(void *pointer, size_t bytes, size_t alignment)
+{
+}
+
+
+void MonotonicBufferResource::addChunk(size_t minimumSize)
+{
+    size_t size = nextChunkSize;
+    while (size < minimumSize) {
+        size *= 2;
+    }
+    nextChunkSize = size * 2;
+
+    void *memory = upstream->allocate(size);
+    chunks.push_back({memory, size});
+    current = static_cast<char *>(memory);
+    remaining = size;
+}
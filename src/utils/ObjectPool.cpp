@@ -0,0 +1,96 @@
+#include "utils/ObjectPool.h"
+
+using namespace bkengine;
+
+
+ObjectPool::ObjectPool(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk)
+    : blockSize(blockSize), blocksPerChunk(blocksPerChunk > 0 ? blocksPerChunk : 1)
+{
+    size_t alignment = std::max(blockAlignment, alignof(FreeBlock));
+
+    if (ObjectPool::blockSize < sizeof(FreeBlock)) {
+        ObjectPool::blockSize = sizeof(FreeBlock);
+    }
+
+    ObjectPool::blockSize = (ObjectPool::blockSize + alignment - 1) / alignment * alignment;
+}
+
+ObjectPool::~ObjectPool()
+{
+    for (void *chunk : chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+void *ObjectPool::allocate()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (freeList == nullptr) {
+        addChunk();
+    }
+
+    FreeBlock *block = freeList;
+    freeList = block->next;
+    freeCount--;
+    return block;
+}
+
+void ObjectPool::deallocate(void *block)
+{
+    if (block == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto freeBlock = static_cast<FreeBlock *>(block);
+    freeBlock->next = freeList;
+    freeList = freeBlock;
+    freeCount++;
+}
+
+void ObjectPool::reserve(size_t blockCount)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    while (freeCount < blockCount) {
+        addChunk();
+    }
+}
+
+size_t ObjectPool::getBlockSize() const
+{
+    return blockSize;
+}
+
+size_t ObjectPool::getCapacity() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return capacity;
+}
+
+size_t ObjectPool::getFreeCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return freeCount;
+}
+
+
+void ObjectPool::addChunk()
+{
+    auto chunk = static_cast<char *>(::operator new(blockSize * blocksPerChunk));
+    chunks.push_back(chunk);
+
+    // blocks are linked in reverse, so they are handed out in address order
+    for (size_t i = blocksPerChunk; i > 0; --i) {
+        auto block = reinterpret_cast<FreeBlock *>(chunk + (i - 1) * blockSize);
+        block->next = freeList;
+        freeList = block;
+    }
+
+    capacity += blocksPerChunk;
+    freeCount += blocksPerChunk;
+}
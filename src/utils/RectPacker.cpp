@@ -0,0 +1,128 @@
+#include "utils/RectPacker.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace bkengine;
+
+
+RectPacker::RectPacker(uint32_t width, uint32_t height, uint32_t padding)
+    : width(width + padding), height(height + padding), padding(padding)
+{
+    reset();
+}
+
+bool RectPacker::insert(uint32_t rectWidth, uint32_t rectHeight, AbsRect &placement)
+{
+    uint32_t paddedWidth = rectWidth + padding;
+    uint32_t paddedHeight = rectHeight + padding;
+
+    size_t bestIndex = skyline.size();
+    uint32_t bestBottom = std::numeric_limits<uint32_t>::max();
+    uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+    uint32_t bestY = 0;
+
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        uint32_t y;
+        if (!fits(i, paddedWidth, paddedHeight, y)) {
+            continue;
+        }
+
+        uint32_t bottom = y + paddedHeight;
+        if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestBottom = bottom;
+            bestWidth = skyline[i].width;
+            bestY = y;
+        }
+    }
+
+    if (bestIndex == skyline.size()) {
+        return false;
+    }
+
+    uint32_t x = skyline[bestIndex].x;
+    addLevel(bestIndex, x, bestY, paddedWidth, paddedHeight);
+    usedArea += static_cast<uint64_t>(rectWidth) * rectHeight;
+
+    placement = AbsRect(x, bestY, rectWidth, rectHeight);
+    return true;
+}
+
+void RectPacker::reset()
+{
+    skyline.clear();
+    skyline.push_back({0, 0, width});
+    usedArea = 0;
+}
+
+uint32_t RectPacker::getWidth() const
+{
+    return width - padding;
+}
+
+uint32_t RectPacker::getHeight() const
+{
+    return height - padding;
+}
+
+double RectPacker::getOccupancy() const
+{
+    uint64_t area = static_cast<uint64_t>(getWidth()) * getHeight();
+    return area > 0 ? static_cast<double>(usedArea) / area : 0;
+}
+
+
+bool RectPacker::fits(size_t index, uint32_t rectWidth, uint32_t rectHeight, uint32_t &y) const
+{
+    if (skyline[index].x + rectWidth > width) {
+        return false;
+    }
+
+    // the rectangle rests on the highest skyline segment below it
+    y = 0;
+    int64_t widthLeft = rectWidth;
+    for (size_t i = index; widthLeft > 0; ++i) {
+        y = std::max(y, skyline[i].y);
+        if (y + rectHeight > height) {
+            return false;
+        }
+        widthLeft -= skyline[i].width;
+    }
+    return true;
+}
+
+void RectPacker::addLevel(size_t index, uint32_t x, uint32_t y, uint32_t rectWidth, uint32_t rectHeight)
+{
+    skyline.insert(skyline.begin() + index, {x, y + rectHeight, rectWidth});
+
+    // cut off the segments now covered by the new one
+    for (size_t i = index + 1; i < skyline.size();) {
+        auto &previous = skyline[i - 1];
+        auto &node = skyline[i];
+        uint32_t previousEnd = previous.x + previous.width;
+
+        if (node.x >= previousEnd) {
+            break;
+        }
+
+        uint32_t shrink = previousEnd - node.x;
+        if (node.width <= shrink) {
+            skyline.erase(skyline.begin() + i);
+            continue;
+        }
+
+        node.x += shrink;
+        node.width -= shrink;
+        break;
+    }
+
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#include "utils/SpatialGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace bkengine;
+
+
+SpatialGrid::SpatialGrid(double cellSize) : cellSize(cellSize)
+{
+    assert(cellSize > 0);
+}
+
+void SpatialGrid::insert(uint32_t id, const AbsRect &rect)
+{
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+
+    auto first = static_cast<int32_t>(std::floor(rect.x / cellSize));
+    auto top = static_cast<int32_t>(std::floor(rect.y / cellSize));
+    auto last = static_cast<int32_t>(std::floor((rect.x + rect.w) / cellSize));
+    auto bottom = static_cast<int32_t>(std::floor((rect.y + rect.h) / cellSize));
+
+    for (int32_t y = top; y <= bottom; ++y) {
+        for (int32_t x = first; x <= last; ++x) {
+            cells[getCellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::clear()
+{
+    // the cell vectors keep their capacity for the next rebuild
+    for (auto &cell : cells) {
+        cell.second.clear();
+    }
+}
+
+void SpatialGrid::query(const Point &point, std::vector<uint32_t> &ids) const
+{
+    auto x = static_cast<int32_t>(std::floor(point.x / cellSize));
+    auto y = static_cast<int32_t>(std::floor(point.y / cellSize));
+
+    auto result = cells.find(getCellKey(x, y));
+    if (result != cells.end()) {
+        ids.insert(ids.end(), result->second.cbegin(), result->second.cend());
+    }
+}
+
+double SpatialGrid::getCellSize() const
+{
+    return cellSize;
+}
+
+size_t SpatialGrid::getCellCount() const
+{
+    size_t count = 0;
+    for (auto &cell : cells) {
+        if (!cell.second.empty()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+uint64_t SpatialGrid::getCellKey(int32_t x, int32_t y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
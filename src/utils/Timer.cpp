@@ -5,7 +5,7 @@ using namespace bkengine;
 
 uint64_t getMilliseconds()
 {
-    auto duration = std::chrono::high_resolution_clock::now().time_since_epoch();
+    auto duration = std::chrono::steady_clock::now().time_since_epoch();
     return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 }
 
@@ -40,7 +40,7 @@ void Timer::pause()
 {
     if (started && !paused) {
         paused = true;
-        pausedTicks = getMilliseconds();
+        pausedTicks = getMilliseconds() - startTicks;
         startTicks = 0;
     }
 }
@@ -49,7 +49,7 @@ void Timer::unpause()
 {
     if (started && paused) {
         paused = false;
-        startTicks = getMilliseconds();
+        startTicks = getMilliseconds() - pausedTicks;
         pausedTicks = 0;
     }
 }
@@ -62,7 +62,7 @@ uint64_t Timer::getTicks() const
         if (paused) {
             time = pausedTicks;
         } else {
-            time = getMilliseconds();
+            time = getMilliseconds() - startTicks;
         }
     }
 
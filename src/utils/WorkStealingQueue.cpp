@@ -0,0 +1,82 @@
+#include "utils/WorkStealingQueue.h"
+
+#include <cassert>
+
+using namespace bkengine;
+
+
+WorkStealingQueue::WorkStealingQueue(uint32_t capacity) : top(0), bottom(0), mask(capacity - 1)
+{
+    assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+    buffer.reset(new std::atomic<Job *>[capacity]);
+    for (uint32_t i = 0; i < capacity; ++i) {
+        buffer[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+bool WorkStealingQueue::push(Job *job)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+
+    if (b - t > mask) {
+        return false;
+    }
+
+    buffer[b & mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job *WorkStealingQueue::pop()
+{
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job *job = buffer[b & mask].load(std::memory_order_relaxed);
+
+    if (t == b) {
+        // last element, race against concurrent steals
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+Job *WorkStealingQueue::steal()
+{
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return nullptr;
+    }
+
+    Job *job = buffer[t & mask].load(std::memory_order_relaxed);
+
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    return job;
+}
+
+bool WorkStealingQueue::empty() const
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return b <= t;
+}
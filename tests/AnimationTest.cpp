@@ -0,0 +1,148 @@
+#include "catch.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "core/builder/AnimationBuilder.h"
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "core/utils/AnimationUtils.h"
+#include "core/utils/ElementUtils.h"
+#include "core/utils/GameUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class SlowGame : public Game
+    {
+    public:
+        uint32_t frameTime = 0;
+
+    protected:
+        bool onLoop() override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(frameTime));
+            return false;
+        }
+    };
+
+    class HookAnimation : public Animation
+    {
+    public:
+        bool onRender() override
+        {
+            calls++;
+            return false;
+        }
+
+        uint32_t calls = 0;
+    };
+
+    template <typename T = Animation>
+    std::shared_ptr<T> createAnimation(const std::shared_ptr<Game> &game,
+                                       const std::shared_ptr<Element> &element,
+                                       AnimationBuilder builder,
+                                       uint32_t textureCount,
+                                       const std::string &name = "animation")
+    {
+        auto animation = builder.setName(name).setParentElement(element).build<T>();
+        auto textureBuilder = TextureBuilder::createImageBuilder();
+        textureBuilder.setGame(game).setFilePath("animation.png");
+        for (uint32_t i = 0; i < textureCount; ++i) {
+            AnimationUtils::addTexture(animation, textureBuilder.setName("texture " + std::to_string(i)).build());
+        }
+        ElementUtils::activateAnimation(element, name);
+        return animation;
+    }
+}
+
+
+TEST_CASE("Animation")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockFramesEventInterface<4>>()
+                    .setImageInterface<MockImageInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .build<SlowGame>();
+    auto scene = SceneBuilder::createBuilder().setName("scene").setParentGame(game).build<Scene>();
+    auto element = ElementBuilder::createBuilder().setName("element").setParentScene(scene).build<Element>();
+
+    SECTION("frame durations")
+    {
+        auto builder = AnimationBuilder::createBuilder().setName("animation");
+        REQUIRE(builder.setFramesPerTexture(30).build<Animation>()->getFrameDuration() == Approx(500));
+        REQUIRE(builder.setFramesPerTexture(30).build<Animation>()->getFramesPerTexture() == 30);
+        REQUIRE(builder.setFrameDuration(250).build<Animation>()->getFramesPerTexture() == 15);
+        REQUIRE(builder.setFramesPerSecond(20).build<Animation>()->getFrameDuration() == Approx(50));
+    }
+
+    SECTION("skip frames")
+    {
+        auto animation = createAnimation(game, element, AnimationBuilder::createBuilder(), 3);
+        animation->skipFrames(7);
+        REQUIRE(animation->getCurrentFrame() == 1);
+    }
+
+    SECTION("fast frames do not advance slow animations")
+    {
+        auto animation = createAnimation(game, element, AnimationBuilder::createBuilder().setFramesPerTexture(1), 3);
+        game->run();
+        REQUIRE(animation->getCurrentFrame() == 0);
+    }
+
+    SECTION("slow frames skip several textures")
+    {
+        game->frameTime = 25;
+        auto animation = createAnimation(game, element, AnimationBuilder::createBuilder().setFrameDuration(10), 100);
+        game->run();
+        REQUIRE(animation->getCurrentFrame() >= 7);
+        REQUIRE(game->getFrameDelta() >= 25);
+    }
+
+    SECTION("animations of a scene are stepped together")
+    {
+        game->frameTime = 25;
+        auto tileBuilder = ElementBuilder::createBuilder().setParentScene(scene);
+        auto animationBuilder = AnimationBuilder::createBuilder().setFrameDuration(10);
+        std::vector<std::shared_ptr<Animation>> animations;
+        for (int i = 0; i < 50; ++i) {
+            auto tile = tileBuilder.setName("tile " + std::to_string(i)).build<Element>();
+            animations.push_back(createAnimation(game, tile, animationBuilder, 1000));
+        }
+        auto hooked = createAnimation<HookAnimation>(game, element, AnimationBuilder::createBuilder(), 2);
+
+        game->run();
+
+        uint32_t frame = animations.front()->getCurrentFrame();
+        REQUIRE(frame >= 7);
+        for (auto &animation : animations) {
+            REQUIRE(animation->getCurrentFrame() == frame);
+        }
+        REQUIRE(hooked->calls == 4);
+    }
+
+    SECTION("playback state survives switching animations")
+    {
+        auto walkBuilder = AnimationBuilder::createBuilder().setFrameDuration(10000);
+        auto walk = createAnimation(game, element, walkBuilder, 100, "walk");
+        walk->skipFrames(5);
+        game->run();
+        REQUIRE(walk->getCurrentFrame() == 5);
+
+        createAnimation(game, element, AnimationBuilder::createBuilder(), 2, "idle");
+        walk->skipFrames(3);
+        game->run();
+        REQUIRE(walk->getCurrentFrame() == 8);
+        REQUIRE(AnimationUtils::getCurrentTexture(walk)->getName() == "texture 8");
+    }
+}
@@ -0,0 +1,175 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "core/utils/GameUtils.h"
+#include "utils/AssetArchive.h"
+#include "utils/Lz4.h"
+
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::vector<uint8_t> compressAndDecompress(const std::vector<uint8_t> &data, size_t &compressedSize)
+    {
+        std::vector<uint8_t> compressed(Lz4::getMaxCompressedSize(data.size()));
+        compressedSize = Lz4::compress(data.data(), data.size(), compressed.data());
+
+        std::vector<uint8_t> decompressed(data.size());
+        REQUIRE(Lz4::decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+        return decompressed;
+    }
+
+    std::vector<uint8_t> toBytes(const std::string &text)
+    {
+        return std::vector<uint8_t>(text.cbegin(), text.cend());
+    }
+}
+
+
+TEST_CASE("Lz4")
+{
+    size_t compressedSize;
+
+    SECTION("small inputs")
+    {
+        for (size_t size = 0; size < 40; ++size) {
+            std::vector<uint8_t> data(size, 'a');
+            REQUIRE(compressAndDecompress(data, compressedSize) == data);
+        }
+    }
+
+    SECTION("repetitive data shrinks")
+    {
+        std::string text;
+        for (int i = 0; i < 1000; ++i) {
+            text += "tile " + std::to_string(i % 7) + ";";
+        }
+        auto data = toBytes(text);
+
+        REQUIRE(compressAndDecompress(data, compressedSize) == data);
+        REQUIRE(compressedSize < data.size() / 4);
+    }
+
+    SECTION("random data")
+    {
+        std::mt19937 random(42);
+        std::vector<uint8_t> data(100000);
+        for (auto &byte : data) {
+            byte = random() % 256;
+        }
+        REQUIRE(compressAndDecompress(data, compressedSize) == data);
+        REQUIRE(compressedSize <= Lz4::getMaxCompressedSize(data.size()));
+    }
+
+    SECTION("malformed blocks")
+    {
+        auto data = toBytes(std::string(300, 'x'));
+        std::vector<uint8_t> compressed(Lz4::getMaxCompressedSize(data.size()));
+        compressedSize = Lz4::compress(data.data(), data.size(), compressed.data());
+
+        std::vector<uint8_t> decompressed(data.size());
+        REQUIRE(!Lz4::decompress(compressed.data(), compressedSize - 1, decompressed.data(), decompressed.size()));
+        REQUIRE(!Lz4::decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size() - 1));
+    }
+}
+
+
+TEST_CASE("AssetArchive")
+{
+    const std::string archivePath = "asset_archive_test.bkpa";
+    auto level = toBytes(std::string(5000, '#') + "level");
+    auto icon = toBytes("icon");
+
+    AssetArchiveWriter writer;
+    writer.addEntry("level.txt", level, true).addEntry("player.png", icon).addEntry("empty", {});
+    writer.write(archivePath);
+
+    SECTION("entries")
+    {
+        auto archive = AssetArchive::open(archivePath);
+        REQUIRE(archive->getEntryNames() == std::vector<std::string>({"empty", "level.txt", "player.png"}));
+        REQUIRE(archive->getEntry("level.txt").flags == AssetArchive::FLAG_LZ4);
+        REQUIRE(archive->getEntry("level.txt").storedSize < level.size());
+
+        auto data = archive->getData("level.txt");
+        REQUIRE(std::vector<uint8_t>(data.data, data.data + data.size) == level);
+
+        data = archive->getData("player.png");
+        REQUIRE(std::vector<uint8_t>(data.data, data.data + data.size) == icon);
+        REQUIRE(reinterpret_cast<uintptr_t>(data.data) % AssetArchive::ALIGNMENT == 0);
+
+        REQUIRE(archive->getData("empty").size == 0);
+        REQUIRE_THROWS_AS(archive->getData("missing"), NameNotFoundException);
+    }
+
+    SECTION("data keeps the archive mapped")
+    {
+        auto data = AssetArchive::open(archivePath)->getData("player.png");
+        REQUIRE(std::vector<uint8_t>(data.data, data.data + data.size) == icon);
+    }
+
+    SECTION("invalid archives")
+    {
+        REQUIRE_THROWS_AS(AssetArchive::open("missing.bkpa"), ArchiveException);
+        REQUIRE_THROWS_AS(writer.addEntry("empty", {}), NameAlreadyExistsException);
+
+        std::ofstream(archivePath, std::ios::binary) << "not an archive, just some text";
+        REQUIRE_THROWS_AS(AssetArchive::open(archivePath), ArchiveException);
+    }
+
+    SECTION("compressed entries larger than their block can expand to")
+    {
+        std::string bytes;
+        {
+            std::ifstream file(archivePath, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        // the uncompressed size directly precedes the name in the index
+        size_t name = bytes.rfind("level.txt");
+        REQUIRE(name != std::string::npos);
+        bytes.replace(name - 8, 8, std::string(8, '\x7f'));
+        std::ofstream(archivePath, std::ios::binary) << bytes;
+
+        REQUIRE_THROWS_AS(AssetArchive::open(archivePath), ArchiveException);
+    }
+
+    SECTION("builders load mounted assets from memory")
+    {
+        auto game = GameBuilder::createBuilder()
+                        .setImageInterface<MockImageInterface>()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .build<Game>();
+        auto archive = AssetArchive::open(archivePath);
+        GameUtils::mountArchive(game, archive);
+
+        AssetData data;
+        REQUIRE(GameUtils::findAsset(game, "player.png", data));
+        REQUIRE(!GameUtils::findAsset(game, "enemy.png", data));
+
+        uint32_t fileRenders = MockImageInterface::renderCount();
+        uint32_t dataRenders = MockImageInterface::dataRenderCount();
+        auto builder = TextureBuilder::createImageBuilder().setGame(game).setCached(false);
+        builder.setName("player").setFilePath("player.png").build();
+        builder.setName("enemy").setFilePath("enemy.png").build();
+        REQUIRE(MockImageInterface::dataRenderCount() == dataRenders + 1);
+        REQUIRE(MockImageInterface::renderCount() == fileRenders + 1);
+
+        GameUtils::unmountArchive(game, archive);
+        REQUIRE(!GameUtils::findAsset(game, "player.png", data));
+    }
+
+    std::remove(archivePath.c_str());
+}
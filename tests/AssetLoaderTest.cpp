@@ -0,0 +1,289 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/AssetLoader.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "interfaces/impl/INISettingsInterface.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockFontInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class LoadedTexture : public Texture
+    {
+    public:
+        void onRender() override
+        {
+        }
+    };
+
+    class PendingTexture : public AsyncTexture
+    {
+    };
+
+    /* Takes a while for every image, so loads are still running when the game is dropped. */
+    class SlowImageInterface : public MockImageInterface
+    {
+    public:
+        static std::atomic<int> &started()
+        {
+            static std::atomic<int> count{0};
+            return count;
+        }
+
+        static std::atomic<int> &finished()
+        {
+            static std::atomic<int> count{0};
+            return count;
+        }
+
+        bool decodeImage(const AssetData &data, DecodedImage &image) override
+        {
+            started()++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            finished()++;
+            return MockImageInterface::decodeImage(data, image);
+        }
+    };
+
+    /* Remembers the threads decoding images, rasterizing glyphs and creating textures. */
+    class ThreadImageInterface : public MockImageInterface
+    {
+    public:
+        static std::thread::id &decodedOn()
+        {
+            static std::thread::id id;
+            return id;
+        }
+
+        static std::thread::id &uploadedOn()
+        {
+            static std::thread::id id;
+            return id;
+        }
+
+        bool decodeImage(const AssetData &data, DecodedImage &image) override
+        {
+            decodedOn() = std::this_thread::get_id();
+            return MockImageInterface::decodeImage(data, image);
+        }
+
+        std::shared_ptr<ImageTexture> uploadImage(const DecodedImage &image, const AbsRect &clip) override
+        {
+            uploadedOn() = std::this_thread::get_id();
+            return MockImageInterface::uploadImage(image, clip);
+        }
+    };
+
+    class ThreadFontInterface : public MockFontInterface
+    {
+    public:
+        static std::thread::id &rasterizedOn()
+        {
+            static std::thread::id id;
+            return id;
+        }
+
+        static std::thread::id &pageCreatedOn()
+        {
+            static std::thread::id id;
+            return id;
+        }
+
+        bool renderGlyph(const std::string &fontName,
+                         double size,
+                         TextQuality quality,
+                         uint32_t codepoint,
+                         GlyphBitmap &glyph) override
+        {
+            rasterizedOn() = std::this_thread::get_id();
+            return MockFontInterface::renderGlyph(fontName, size, quality, codepoint, glyph);
+        }
+
+        std::shared_ptr<ImageTexture> createGlyphPage(const Size &size, TextQuality quality) override
+        {
+            pageCreatedOn() = std::this_thread::get_id();
+            return MockFontInterface::createGlyphPage(size, quality);
+        }
+    };
+
+    class DestroyedGame : public Game
+    {
+    public:
+        ~DestroyedGame()
+        {
+            destroyedOn() = std::this_thread::get_id();
+        }
+
+        static std::thread::id &destroyedOn()
+        {
+            static std::thread::id id;
+            return id;
+        }
+    };
+}
+
+
+TEST_CASE("AssetLoader")
+{
+    SECTION("textures are swapped in at the next frame")
+    {
+        auto game = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setEventInterface<MockEventInterface>()
+                        .setImageInterface<MockImageInterface>()
+                        .setSettingsInterface<INISettingsInterface>()
+                        .setWorkerCount(2)
+                        .build<Game>();
+        auto placeholder = std::make_shared<LoadedTexture>();
+
+        auto builder = TextureBuilder::createImageBuilder().setGame(game).setFilePath("player.png");
+        auto texture = builder.setName("player").setPlaceholder(placeholder).buildAsync();
+        REQUIRE(texture->getName() == "player");
+        REQUIRE(texture->getTexture() == placeholder);
+
+        while (game->getAssetLoader()->getPendingCount() > 0 && !texture->isLoaded()) {
+            game->run();
+        }
+
+        REQUIRE(texture->isLoaded());
+        REQUIRE(texture->getTexture() != placeholder);
+        REQUIRE(texture->getTexture()->getName() == "player");
+
+        REQUIRE_THROWS_AS(builder.setName("").buildAsync(), BuilderException);
+    }
+
+    SECTION("textures are created on the thread applying the loads")
+    {
+        std::ofstream("async.png", std::ios::binary) << "pixels";
+        auto game = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setEventInterface<MockEventInterface>()
+                        .setImageInterface<ThreadImageInterface>()
+                        .setFontInterface<ThreadFontInterface>()
+                        .setSettingsInterface<INISettingsInterface>()
+                        .setWorkerCount(2)
+                        .build<Game>();
+
+        auto image = TextureBuilder::createImageBuilder().setGame(game).setName("image").setFilePath("async.png");
+        auto text = TextureBuilder::createTextBuilder().setGame(game).setName("text").setText("async");
+        auto imageTexture = image.setCached(false).buildAsync();
+        auto textTexture = text.setFontName("font").setFontSize(12).buildAsync();
+
+        auto loader = game->getAssetLoader();
+        while (loader->getPendingCount() > 0) {
+            loader->applyLoaded();
+        }
+        std::remove("async.png");
+
+        REQUIRE(imageTexture->isLoaded());
+        REQUIRE(textTexture->isLoaded());
+        REQUIRE(ThreadImageInterface::decodedOn() != std::this_thread::get_id());
+        REQUIRE(ThreadImageInterface::uploadedOn() == std::this_thread::get_id());
+        REQUIRE(ThreadFontInterface::rasterizedOn() != std::this_thread::get_id());
+        REQUIRE(ThreadFontInterface::pageCreatedOn() == std::this_thread::get_id());
+    }
+
+    SECTION("priorities and cancellation")
+    {
+        auto jobSystem = std::make_shared<JobSystem>(1);
+        AssetLoader loader(jobSystem);
+
+        std::atomic<bool> blocked{true};
+        std::mutex mutex;
+        std::vector<int> order;
+        auto load = [&](int id) {
+            return [&, id]() -> AssetLoader::Upload {
+                while (id == 0 && blocked) {
+                    std::this_thread::yield();
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(id);
+                return []() { return std::make_shared<LoadedTexture>(); };
+            };
+        };
+
+        std::vector<std::shared_ptr<AsyncTexture>> textures;
+        std::vector<int32_t> priorities = {100, 1, 5, 3, 5};
+        for (int i = 0; i < 5; ++i) {
+            textures.push_back(std::make_shared<PendingTexture>());
+            loader.load(textures.back(), load(i), priorities[i]);
+        }
+        textures[4]->cancel();
+        blocked = false;
+
+        while (loader.getPendingCount() > 4) {
+            std::this_thread::yield();
+        }
+        REQUIRE(loader.applyLoaded() == 4);
+        REQUIRE(loader.getPendingCount() == 0);
+
+        REQUIRE(order == std::vector<int>({0, 2, 3, 1}));
+        REQUIRE(textures[3]->isLoaded());
+        REQUIRE(textures[4]->getState() == LoadState::CANCELLED);
+        REQUIRE(textures[4]->getTexture() == nullptr);
+    }
+
+    SECTION("failed loads")
+    {
+        AssetLoader loader(std::make_shared<JobSystem>(0));
+        auto texture = std::make_shared<PendingTexture>();
+        loader.load(texture, []() -> AssetLoader::Upload { throw std::runtime_error("file not found"); });
+        loader.finish();
+
+        REQUIRE(texture->getState() == LoadState::FAILED);
+        REQUIRE(texture->getError() == "file not found");
+
+        auto uploaded = std::make_shared<PendingTexture>();
+        loader.load(uploaded, []() -> AssetLoader::Upload {
+            return []() -> std::shared_ptr<Texture> { throw std::runtime_error("out of memory"); };
+        });
+        loader.finish();
+        REQUIRE(uploaded->getError() == "out of memory");
+    }
+
+    SECTION("dropping the game while loads are running")
+    {
+        std::ofstream("image.png", std::ios::binary) << "pixels";
+        auto game = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setImageInterface<SlowImageInterface>()
+                        .setWorkerCount(1)
+                        .build<DestroyedGame>();
+
+        std::vector<std::shared_ptr<AsyncTexture>> textures;
+        for (int i = 0; i < 3; ++i) {
+            auto builder = TextureBuilder::createImageBuilder().setGame(game).setCached(false);
+            textures.push_back(builder.setName("image" + std::to_string(i)).setFilePath("image.png").buildAsync());
+        }
+        while (SlowImageInterface::started() == 0) {
+            std::this_thread::yield();
+        }
+
+        game = nullptr;
+        std::remove("image.png");
+
+        // the running load finished before the game was destroyed on this thread, the queued ones were dropped
+        REQUIRE(DestroyedGame::destroyedOn() == std::this_thread::get_id());
+        REQUIRE(SlowImageInterface::finished() == SlowImageInterface::started());
+        REQUIRE(SlowImageInterface::started() == 1);
+        for (auto &texture : textures) {
+            REQUIRE(!texture->isLoaded());
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include "catch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "core/GlyphRunTexture.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "utils/DistanceField.h"
+
+#include "mocks/MockFontInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+TEST_CASE("DistanceField")
+{
+    SECTION("transform")
+    {
+        const uint32_t width = 7, height = 5;
+        std::vector<double> grid(width * height, DistanceField::getInfinity());
+        grid[2 * width + 3] = 0;
+        DistanceField::transform(grid, width, height);
+
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                double dx = x - 3.0, dy = y - 2.0;
+                REQUIRE(grid[y * width + x] == Approx(dx * dx + dy * dy));
+            }
+        }
+    }
+
+    SECTION("generate")
+    {
+        const uint32_t size = 8, spread = 2;
+        std::vector<uint8_t> coverage(size * size, 255);
+        auto field = DistanceField::generate(coverage.data(), size, size, spread);
+
+        const uint32_t fieldSize = size + 2 * spread;
+        REQUIRE(field.size() == fieldSize * fieldSize);
+        auto at = [&field, fieldSize](uint32_t x, uint32_t y) { return field[y * fieldSize + x]; };
+
+        REQUIRE(at(0, 0) == 0);
+        REQUIRE(at(fieldSize / 2, fieldSize / 2) == 255);
+        // the cells next to the outline lie half a pixel inside and outside
+        REQUIRE(at(spread, fieldSize / 2) > 128);
+        REQUIRE(at(spread - 1, fieldSize / 2) < 128);
+        REQUIRE(at(spread, fieldSize / 2) + at(spread - 1, fieldSize / 2) == 256);
+        for (uint32_t x = 1; x < fieldSize / 2; ++x) {
+            REQUIRE(at(x, fieldSize / 2) >= at(x - 1, fieldSize / 2));
+        }
+    }
+}
+
+TEST_CASE("Distance field text")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setFontInterface<MockFontInterface>()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .build<Game>();
+    auto builder = TextureBuilder::createTextBuilder().setGame(game).setName("label").setFontName("font");
+    builder.setTextQuality(TextQuality::SDF).setText("ab");
+
+    auto small = std::dynamic_pointer_cast<GlyphRunTexture>(builder.setFontSize(12).build());
+    uint32_t renders = MockFontInterface::glyphRenderCount();
+    auto large = std::dynamic_pointer_cast<GlyphRunTexture>(builder.setFontSize(96).build());
+
+    REQUIRE(small->getAtlas() == large->getAtlas());
+    REQUIRE(small->getAtlas()->getFontSize() == GlyphAtlas::SDF_SIZE);
+    REQUIRE(MockFontInterface::glyphRenderCount() == renders);
+
+    // glyphs of the mock are half the size wide, padded by the spread
+    auto &quad = large->getQuads().front();
+    REQUIRE(quad.source.w == GlyphAtlas::SDF_SIZE / 2 + 2 * GlyphAtlas::SDF_SPREAD);
+    REQUIRE(quad.destination.w == Approx(quad.source.w * 2));
+    REQUIRE(large->getTextSize().w == Approx(small->getTextSize().w * 8));
+
+    large->setText("abc");
+    REQUIRE(large->getQuads().back().destination.w == Approx(quad.source.w * 2));
+}
+
+TEST_CASE("Distance field pages")
+{
+    auto fontInterface = std::make_shared<MockFontInterface>();
+
+    SECTION("pages are created for their quality")
+    {
+        GlyphAtlas sdf(fontInterface, "font", GlyphAtlas::SDF_SIZE, TextQuality::SDF);
+        GlyphAtlas solid(fontInterface, "font", 12, TextQuality::SOLID);
+        TextLayout sdfLayout, solidLayout;
+        REQUIRE(sdf.layout("a", sdfLayout));
+        REQUIRE(solid.layout("a", solidLayout));
+
+        auto sdfPage = std::static_pointer_cast<MockGlyphPage>(sdf.getPage(0));
+        auto solidPage = std::static_pointer_cast<MockGlyphPage>(solid.getPage(0));
+        REQUIRE(sdfPage->quality == TextQuality::SDF);
+        REQUIRE(solidPage->quality == TextQuality::SOLID);
+
+        // coverage is fully opaque inside the glyph, distances fade out around the outline at 128
+        auto &field = sdfPage->glyphs.front().pixels;
+        REQUIRE(*std::min_element(field.begin(), field.end()) == 0);
+        REQUIRE(std::any_of(field.begin(), field.end(), [](uint8_t value) { return value > 0 && value < 128; }));
+        auto &coverage = solidPage->glyphs.front().pixels;
+        REQUIRE(std::all_of(coverage.begin(), coverage.end(), [](uint8_t value) { return value == 255; }));
+    }
+
+    SECTION("texts rendered without glyph support fall back to BLENDED")
+    {
+        auto game = GameBuilder::createBuilder()
+                        .setFontInterface<MockFontInterface>()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .build<Game>();
+        auto builder = TextureBuilder::createTextBuilder().setGame(game).setName("label").setFontName("font");
+        builder.setTextQuality(TextQuality::SDF).setText("ab").setFontSize(12).setCached(false).build();
+
+        REQUIRE(MockFontInterface::lastRenderQuality() == TextQuality::BLENDED);
+    }
+}
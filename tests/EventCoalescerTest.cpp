@@ -0,0 +1,138 @@
+#include "catch.hpp"
+
+#include <vector>
+
+#include "core/builder/GameBuilder.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "utils/EventCoalescer.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockEvents.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::vector<Event> coalesce(EventCoalescer &coalescer, const std::vector<Event> &events)
+    {
+        std::vector<Event> result;
+        Event completed;
+        for (auto &event : events) {
+            if (coalescer.add(event, completed)) {
+                result.push_back(completed);
+            }
+        }
+        if (coalescer.flush(completed)) {
+            result.push_back(completed);
+        }
+        return result;
+    }
+
+    class CountingGame : public Game
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            if (event.type != EventType::QUIT) {
+                events.push_back(event);
+            }
+            return false;
+        }
+
+        std::vector<Event> events;
+    };
+}
+
+
+TEST_CASE("EventCoalescer")
+{
+    EventCoalescer coalescer;
+    REQUIRE(!coalescer.isEnabled());
+
+    SECTION("only motion and wheel events can be coalesced")
+    {
+        coalescer.setCoalescing(EventType::KEYBOARD, true);
+        REQUIRE(!coalescer.isCoalescing(EventType::KEYBOARD));
+        REQUIRE(!coalescer.isEnabled());
+
+        coalescer.setCoalescing(EventType::WHEEL, true);
+        REQUIRE(coalescer.isCoalescing(EventType::WHEEL));
+        REQUIRE(coalescer.isEnabled());
+    }
+
+    SECTION("motion events")
+    {
+        coalescer.setCoalescing(EventType::MOTION, true);
+        auto events = coalesce(coalescer,
+                               {createMotionEvent(11, 20, 1, 0, 1),
+                                createMotionEvent(13, 19, 2, -1, 2),
+                                createMotionEvent(16, 19, 3, 0, 3)});
+
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].motion.x == 16);
+        REQUIRE(events[0].motion.y == 19);
+        REQUIRE(events[0].motion.relativeX == 6);
+        REQUIRE(events[0].motion.relativeY == -1);
+        REQUIRE(events[0].timestamp == 3);
+    }
+
+    SECTION("other events split runs and keep their order")
+    {
+        coalescer.setCoalescing(EventType::MOTION, true);
+        coalescer.setCoalescing(EventType::WHEEL, true);
+        auto events = coalesce(coalescer,
+                               {createMotionEvent(1, 0, 1, 0),
+                                createMotionEvent(2, 0, 1, 0),
+                                createKeyEvent(Keys::A),
+                                createKeyEvent(Keys::B),
+                                createMotionEvent(3, 0, 1, 0),
+                                createWheelEvent(0, 1),
+                                createWheelEvent(0, 2),
+                                createWheelEvent(0, 1, WheelDirection::FLIPPED)});
+
+        REQUIRE(events.size() == 6);
+        REQUIRE(events[0].type == EventType::MOTION);
+        REQUIRE(events[0].motion.relativeX == 2);
+        REQUIRE(events[1].keyboard.key == Keys::A);
+        REQUIRE(events[2].keyboard.key == Keys::B);
+        REQUIRE(events[3].motion.relativeX == 1);
+        REQUIRE(events[4].wheel.y == 3);
+        REQUIRE(events[5].wheel.direction == WheelDirection::FLIPPED);
+    }
+
+    SECTION("disabled types are passed on unchanged")
+    {
+        coalescer.setCoalescing(EventType::WHEEL, true);
+        auto events = coalesce(coalescer, {createMotionEvent(1, 0, 1, 0), createMotionEvent(2, 0, 1, 0)});
+        REQUIRE(events.size() == 2);
+    }
+}
+
+TEST_CASE("Game coalesces events of a frame")
+{
+    MockScriptedEventInterface::script() = {
+        {createMotionEvent(1, 1, 1, 1), createMotionEvent(2, 2, 1, 1), createMotionEvent(4, 2, 2, 0)},
+        {createMotionEvent(5, 2, 1, 0)}};
+
+    auto builder = GameBuilder::createBuilder()
+                       .setGraphicsInterface<MockGraphicsInterface>()
+                       .setEventInterface<MockScriptedEventInterface>()
+                       .setSettingsInterface<INISettingsInterface>();
+    REQUIRE_THROWS_AS(builder.setEventCoalescing(EventType::KEYBOARD, true), BuilderException);
+
+    auto uncoalesced = builder.build<CountingGame>();
+    uncoalesced->run();
+    REQUIRE(uncoalesced->events.size() == 4);
+
+    auto game = builder.setEventCoalescing(EventType::MOTION, true).build<CountingGame>();
+    game->run();
+    MockScriptedEventInterface::script().clear();
+
+    REQUIRE(game->events.size() == 2);
+    REQUIRE(game->events[0].motion.relativeX == 4);
+    REQUIRE(game->events[0].motion.x == 4);
+    REQUIRE(game->events[1].motion.relativeX == 1);
+    REQUIRE(game->getInputState().getMousePosition() == Point(5, 2));
+}
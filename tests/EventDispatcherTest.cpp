@@ -0,0 +1,108 @@
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/utils/ElementUtils.h"
+#include "core/utils/SceneUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockEvents.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::vector<std::string> received;
+
+    class RecordingElement : public Element
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            if (event.type != EventType::QUIT) {
+                received.push_back(getName());
+            }
+            return false;
+        }
+    };
+}
+
+
+TEST_CASE("EventDispatcher")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockScriptedEventInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .build<Game>();
+    auto scene = SceneBuilder::createBuilder().setName("scene").setParentGame(game).build<Scene>();
+
+    auto builder = ElementBuilder::createBuilder().setParentScene(scene);
+    auto everything = builder.setName("everything").build<RecordingElement>();
+    auto keys = ElementBuilder::createBuilder()
+                    .setParentScene(scene)
+                    .setName("keys")
+                    .addEventSubscription(EventSubscription::forType(EventType::KEYBOARD))
+                    .build<RecordingElement>();
+    auto jump = ElementBuilder::createBuilder()
+                    .setParentScene(scene)
+                    .setName("jump")
+                    .addEventSubscription(EventSubscription::forKey(Keys::SPACE))
+                    .addEventSubscription(EventSubscription::forType(EventType::KEYBOARD))
+                    .build<RecordingElement>();
+    auto button = ElementBuilder::createBuilder()
+                      .setParentScene(scene)
+                      .setName("button")
+                      .addEventSubscription(EventSubscription::forRegion(EventType::MOTION, {10, 10, 20, 20}))
+                      .addEventSubscription(EventSubscription::forRegion(EventType::WHEEL, {10, 10, 20, 20}))
+                      .build<RecordingElement>();
+    received.clear();
+
+    auto run = [&game](const std::vector<Event> &events) {
+        MockScriptedEventInterface::script() = {events};
+        received.clear();
+        game->run();
+        MockScriptedEventInterface::script().clear();
+        return received;
+    };
+
+    SECTION("types and keys")
+    {
+        REQUIRE(run({createKeyEvent(Keys::A)}) == std::vector<std::string>({"everything", "keys", "jump"}));
+        REQUIRE(run({createKeyEvent(Keys::SPACE)}) == std::vector<std::string>({"everything", "keys", "jump"}));
+
+        ElementUtils::unsubscribeAll(jump);
+        ElementUtils::subscribe(jump, EventSubscription::forKey(Keys::SPACE));
+        REQUIRE(run({createKeyEvent(Keys::A)}) == std::vector<std::string>({"everything", "keys"}));
+        REQUIRE(run({createKeyEvent(Keys::SPACE)}) == std::vector<std::string>({"everything", "keys", "jump"}));
+    }
+
+    SECTION("regions")
+    {
+        REQUIRE(run({createMotionEvent(0, 0)}) == std::vector<std::string>({"everything"}));
+        REQUIRE(run({createMotionEvent(15, 25)}) == std::vector<std::string>({"everything", "button"}));
+        REQUIRE(run({createWheelEvent()}) == std::vector<std::string>({"everything", "button"}));
+        REQUIRE(run({createMotionEvent(30, 15), createWheelEvent()}) == std::vector<std::string>({"everything",
+                                                                                                 "everything"}));
+    }
+
+    SECTION("subscription changes")
+    {
+        ElementUtils::unsubscribeAll(everything);
+        REQUIRE(run({createKeyEvent(Keys::A)}) == std::vector<std::string>({"keys", "jump"}));
+
+        ElementUtils::subscribeToAll(keys);
+        REQUIRE(ElementUtils::isSubscribedToAll(keys));
+        REQUIRE(run({createMotionEvent(15, 15)}) == std::vector<std::string>({"keys", "button"}));
+
+        SceneUtils::removeElement(scene, "keys");
+        REQUIRE(run({createKeyEvent(Keys::SPACE)}) == std::vector<std::string>({"jump"}));
+    }
+}
@@ -0,0 +1,243 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "core/builder/GameBuilder.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "interfaces/impl/ReplayEventInterface.h"
+#include "utils/EventLog.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockEvents.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class ThrowingGame : public Game
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            if (event.type == EventType::KEYBOARD && event.keyboard.state == KeyState::UP) {
+                throw std::runtime_error("crash");
+            }
+            return false;
+        }
+    };
+
+    class RecordingGame : public Game
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            frames.push_back(getFrameIndex());
+            events.push_back(event);
+            return false;
+        }
+
+        std::vector<uint64_t> frames;
+        std::vector<Event> events;
+    };
+}
+
+
+TEST_CASE("EventLog")
+{
+    std::string logPath = "events.bkel";
+
+    SECTION("events are written and read back")
+    {
+        auto key = createKeyEvent(Keys::Q);
+        key.timestamp = 1000;
+        auto button = createButtonEvent(Buttons::RIGHT, ButtonState::DOWN, 10, -20);
+        button.windowId = 2;
+        button.mouse.clicks = 2;
+
+        {
+            EventRecorder recorder(logPath);
+            recorder.record(0, key);
+            recorder.record(0, button);
+            recorder.record(3, createMotionEvent(5, 6, -7, 8));
+            recorder.record(4, createWindowEvent(WindowEventType::RESIZED, 640, 480));
+            recorder.flush();
+            REQUIRE(recorder.getCount() == 4);
+        }
+
+        auto events = EventLog::load(logPath);
+        REQUIRE(events.size() == 4);
+        REQUIRE(events[0].frame == 0);
+        REQUIRE(events[0].event.type == EventType::KEYBOARD);
+        REQUIRE(events[0].event.timestamp == 1000);
+        REQUIRE(events[0].event.keyboard.key == Keys::Q);
+        REQUIRE(events[0].event.keyboard.state == KeyState::DOWN);
+        REQUIRE(events[1].event.windowId == 2);
+        REQUIRE(events[1].event.mouse.button == Buttons::RIGHT);
+        REQUIRE(events[1].event.mouse.clicks == 2);
+        REQUIRE(events[1].event.mouse.y == -20);
+        REQUIRE(events[2].frame == 3);
+        REQUIRE(events[2].event.motion.relativeX == -7);
+        REQUIRE(events[2].event.motion.relativeY == 8);
+        REQUIRE(events[3].event.type == EventType::WINDOW);
+        REQUIRE(events[3].event.window.type == WindowEventType::RESIZED);
+        REQUIRE(events[3].event.window.data2 == 480);
+    }
+
+    SECTION("invalid logs are rejected")
+    {
+        REQUIRE_THROWS_AS(EventLog::load("missing.bkel"), EventLogException);
+
+        {
+            std::ofstream file(logPath, std::ios::binary);
+            file << "not an event log";
+        }
+        REQUIRE_THROWS_AS(EventLog::load(logPath), EventLogException);
+    }
+
+    SECTION("values out of range are rejected")
+    {
+        auto writeRecord = [&logPath](const std::string &bytes) {
+            {
+                EventRecorder recorder(logPath);
+            }
+            std::ofstream file(logPath, std::ios::binary | std::ios::app);
+            file.write(bytes.data(), bytes.size());
+        };
+
+        // frame delta, type, timestamp, window and the fields of the type
+        writeRecord(std::string("\x00\x09\x00\x00", 4));
+        REQUIRE_THROWS_AS(EventLog::load(logPath), EventLogException);
+
+        writeRecord(std::string("\x00\x01\x00\x00\x11\x00\x07\x00", 8));
+        REQUIRE_THROWS_AS(EventLog::load(logPath), EventLogException);
+
+        writeRecord(std::string("\x00\x04\x00\x00\x00\x00\x00\x00\x01\x00\x00\x00\x05", 13));
+        REQUIRE_THROWS_AS(EventLog::load(logPath), EventLogException);
+
+        writeRecord(std::string("\x00\x06\x00\x00\x10\x00\x00\x00\x00\x00\x00\x00\x00", 13));
+        REQUIRE_THROWS_AS(EventLog::load(logPath), EventLogException);
+
+        writeRecord(std::string("\x00\x01\x00\x00\x11\x00\x01\x00", 8));
+        REQUIRE(EventLog::load(logPath).size() == 1);
+    }
+
+    SECTION("logs cut off inside a record are truncated")
+    {
+        auto writeRecord = [&logPath](const std::string &bytes) {
+            {
+                EventRecorder recorder(logPath);
+                recorder.record(0, createKeyEvent(Keys::A));
+            }
+            std::ofstream file(logPath, std::ios::binary | std::ios::app);
+            file.write(bytes.data(), bytes.size());
+        };
+
+        // the first bytes of a frame delta of 300
+        writeRecord(std::string("\xac", 1));
+        REQUIRE_THROWS_WITH(EventLog::load(logPath), Catch::Contains("truncated"));
+
+        writeRecord(std::string("\xac\x02\x01\x00\x00\x11", 6));
+        REQUIRE_THROWS_WITH(EventLog::load(logPath), Catch::Contains("truncated"));
+
+        writeRecord(std::string("\xac\x02\x01\x00", 4));
+        REQUIRE_THROWS_WITH(EventLog::load(logPath), Catch::Contains("truncated"));
+
+        writeRecord(std::string("\xac\x02\x01\x00\x00\x11\x00\x07\x00", 9));
+        REQUIRE_THROWS_WITH(EventLog::load(logPath), Catch::Contains("corrupt"));
+
+        writeRecord("");
+        REQUIRE(EventLog::load(logPath).size() == 1);
+    }
+
+    std::remove(logPath.c_str());
+}
+
+TEST_CASE("ReplayEventInterface")
+{
+    ReplayEventInterface replay;
+    replay.setEvents({{0, createKeyEvent(Keys::A, KeyState::DOWN)}, {2, createKeyEvent(Keys::A, KeyState::UP)}});
+
+    replay.beginFrame(0);
+    REQUIRE(replay.ready());
+    REQUIRE(replay.poll().keyboard.state == KeyState::DOWN);
+    REQUIRE(!replay.ready());
+
+    replay.beginFrame(1);
+    REQUIRE(!replay.ready());
+
+    replay.beginFrame(2);
+    REQUIRE(replay.ready());
+    REQUIRE(replay.poll().keyboard.state == KeyState::UP);
+    REQUIRE(replay.isFinished());
+    REQUIRE(!replay.ready());
+
+    replay.beginFrame(3);
+    REQUIRE(replay.ready());
+    REQUIRE(replay.poll().type == EventType::QUIT);
+    REQUIRE(!replay.ready());
+}
+
+TEST_CASE("Game replays recorded events at the same frames")
+{
+    std::string logPath = "replay.bkel";
+    MockScriptedEventInterface::script() = {{createKeyEvent(Keys::A, KeyState::DOWN), createMotionEvent(1, 2, 1, 2)},
+                                            {},
+                                            {},
+                                            {createKeyEvent(Keys::A, KeyState::UP)}};
+
+    auto recorded = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setEventInterface<MockScriptedEventInterface>()
+                        .setSettingsInterface<INISettingsInterface>()
+                        .setEventRecording(logPath)
+                        .build<RecordingGame>();
+    recorded->run();
+    MockScriptedEventInterface::script().clear();
+    REQUIRE(recorded->getEventRecorder()->getCount() == 4);
+
+    auto replayed = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setEventInterface<MockScriptedEventInterface>()
+                        .setSettingsInterface<INISettingsInterface>()
+                        .setEventReplay(logPath)
+                        .build<RecordingGame>();
+    replayed->run();
+
+    REQUIRE(replayed->frames == recorded->frames);
+    REQUIRE(replayed->frames == std::vector<uint64_t>({0, 0, 3, 4}));
+    REQUIRE(replayed->events.size() == recorded->events.size());
+    for (size_t i = 0; i < replayed->events.size(); ++i) {
+        REQUIRE(replayed->events[i].type == recorded->events[i].type);
+    }
+    REQUIRE(replayed->events[3].type == EventType::QUIT);
+
+    std::remove(logPath.c_str());
+}
+
+TEST_CASE("Recorded events survive an exception in the game loop")
+{
+    std::string logPath = "crash.bkel";
+    MockScriptedEventInterface::script() = {{createKeyEvent(Keys::A, KeyState::DOWN)},
+                                            {createMotionEvent(1, 2, 1, 2), createKeyEvent(Keys::A, KeyState::UP)}};
+
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockScriptedEventInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .setEventRecording(logPath)
+                    .build<ThrowingGame>();
+    REQUIRE_THROWS_AS(game->run(), std::runtime_error);
+    MockScriptedEventInterface::script().clear();
+
+    auto events = EventLog::load(logPath);
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[2].frame == 1);
+    REQUIRE(events[2].event.keyboard.state == KeyState::UP);
+
+    std::remove(logPath.c_str());
+}
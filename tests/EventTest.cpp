@@ -0,0 +1,63 @@
+#include "catch.hpp"
+
+#include <string>
+#include <type_traits>
+
+#include "utils/Event.h"
+#include "utils/Keys.h"
+
+using namespace bkengine;
+
+
+static_assert(!std::is_polymorphic<Event>::value, "events must not carry a vtable");
+static_assert(std::is_trivially_copyable<WindowEvent>::value, "window events must not allocate");
+static_assert(std::is_trivially_copyable<Key>::value && sizeof(Key) == sizeof(uint16_t), "keys are plain codes");
+static_assert(Keys::A != Keys::B && Keys::A == Keys::A, "keys are compared at compile time");
+
+
+TEST_CASE("Event")
+{
+    Event event;
+    REQUIRE(event.type == EventType::UNKNOWN);
+    REQUIRE(event.timestamp == 0);
+
+    SECTION("timestamps are monotonic")
+    {
+        uint64_t first = Event::getTimestamp();
+        REQUIRE(Event::getTimestamp() >= first);
+    }
+
+    SECTION("copy")
+    {
+        event.type = EventType::MOTION;
+        event.timestamp = Event::getTimestamp();
+        event.windowId = 2;
+        event.motion = {10, 20, -1, 3};
+
+        Event copy(event);
+        REQUIRE(copy.type == EventType::MOTION);
+        REQUIRE(copy.timestamp == event.timestamp);
+        REQUIRE(copy.windowId == 2);
+        REQUIRE(copy.motion.x == 10);
+        REQUIRE(copy.motion.relativeY == 3);
+
+        Event keyboard;
+        keyboard.type = EventType::KEYBOARD;
+        keyboard.keyboard = {Keys::NP_ENTER, KeyState::DOWN, false};
+        copy = keyboard;
+        REQUIRE(copy.type == EventType::KEYBOARD);
+        REQUIRE(copy.keyboard.key == Keys::NP_ENTER);
+    }
+}
+
+TEST_CASE("Key")
+{
+    REQUIRE(Key() == Keys::UNKNOWN);
+    REQUIRE(Button() == Buttons::UNKNOWN);
+    REQUIRE(Keys::A.toString() == "A");
+    REQUIRE(Keys::NP_SEPARATOR.toString() == "NP_SEPARATOR");
+    REQUIRE(Keys::POWER.getCode() == Keys::COUNT - 1);
+    REQUIRE(std::string(static_cast<const char *>(Keys::F12)) == "F12");
+    REQUIRE(Buttons::MIDDLE.toString() == "MIDDLE");
+    REQUIRE(Buttons::SPECIAL.getCode() == Buttons::COUNT - 1);
+}
@@ -0,0 +1,190 @@
+#include "catch.hpp"
+
+#include <memory>
+#include <string>
+
+#include "core/GlyphAtlas.h"
+#include "core/GlyphRunTexture.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+
+#include "mocks/MockFontInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class UnsupportedFontInterface : public FontInterface
+    {
+    public:
+        void registerFont(const std::string &, const std::string &, double) override
+        {
+        }
+
+        std::shared_ptr<TextTexture>
+        renderFontToTexture(const std::string &, const std::string &, double, TextQuality) override
+        {
+            return std::allocate_shared<MockFontTexture>(PoolAllocator<MockFontTexture>());
+        }
+    };
+
+    /* Font without glyphs outside of the basic multilingual plane, e.g. emoji. */
+    class BasicPlaneFontInterface : public MockFontInterface
+    {
+    public:
+        bool renderGlyph(const std::string &fontName,
+                         double size,
+                         TextQuality quality,
+                         uint32_t codepoint,
+                         GlyphBitmap &glyph) override
+        {
+            if (codepoint > 0xffff) {
+                glyphRenderCount()++;
+                return false;
+            }
+            return MockFontInterface::renderGlyph(fontName, size, quality, codepoint, glyph);
+        }
+    };
+}
+
+
+TEST_CASE("GlyphAtlas")
+{
+    auto fontInterface = std::make_shared<MockFontInterface>();
+    GlyphAtlas atlas(fontInterface, "font", 20, TextQuality::BLENDED);
+    TextLayout layout;
+    auto &quads = layout.quads;
+
+    SECTION("layout")
+    {
+        REQUIRE(atlas.layout("ab a", layout));
+        REQUIRE(quads.size() == 3);
+        REQUIRE(atlas.getGlyphCount() == 3);
+        REQUIRE(atlas.getPageCount() == 1);
+
+        REQUIRE(quads[0].destination == AbsRect(1, 0, 10, 20));
+        REQUIRE(quads[1].destination == AbsRect(13, 0, 10, 20));
+        REQUIRE(quads[2].destination == AbsRect(37, 0, 10, 20));
+        REQUIRE(quads[0].source == quads[2].source);
+        REQUIRE(layout.bounds.w == 48);
+        REQUIRE(layout.bounds.h == 20);
+    }
+
+    SECTION("glyphs are rasterized once")
+    {
+        uint32_t renders = MockFontInterface::glyphRenderCount();
+        REQUIRE(atlas.layout("score: 100", layout));
+        REQUIRE(MockFontInterface::glyphRenderCount() == renders + 9);
+        REQUIRE(atlas.layout("score: 101", layout));
+        REQUIRE(MockFontInterface::glyphRenderCount() == renders + 9);
+    }
+
+    SECTION("glyphs rasterized ahead of the layout")
+    {
+        REQUIRE(atlas.layout("a", layout));
+
+        GlyphBitmaps bitmaps;
+        atlas.rasterize("abba", bitmaps);
+        REQUIRE(bitmaps.size() == 1);
+        REQUIRE(bitmaps.count('b') == 1);
+        REQUIRE(atlas.getGlyphCount() == 1);
+
+        uint32_t renders = MockFontInterface::glyphRenderCount();
+        REQUIRE(atlas.layout("abba", layout, 1, &bitmaps));
+        REQUIRE(MockFontInterface::glyphRenderCount() == renders);
+        REQUIRE(atlas.getGlyphCount() == 2);
+        REQUIRE(quads.size() == 4);
+    }
+
+    SECTION("utf-8")
+    {
+        REQUIRE(atlas.layout(u8"ä€\U0001f600", layout));
+        REQUIRE(atlas.getGlyphCount() == 3);
+        REQUIRE(atlas.layout("\xe2\x82", layout));
+        REQUIRE(atlas.getGlyphCount() == 4);
+    }
+
+    SECTION("full pages")
+    {
+        GlyphAtlas large(fontInterface, "font", 200, TextQuality::BLENDED);
+        std::string text;
+        for (char c = 'a'; c <= 'z'; ++c) {
+            text += c;
+        }
+        REQUIRE(large.layout(text, layout));
+        REQUIRE(large.getPageCount() > 1);
+        for (auto &quad : quads) {
+            REQUIRE(quad.page < large.getPageCount());
+            REQUIRE(quad.source.x + quad.source.w <= GlyphAtlas::PAGE_SIZE);
+            REQUIRE(quad.source.y + quad.source.h <= GlyphAtlas::PAGE_SIZE);
+        }
+    }
+
+    SECTION("glyphs the font cannot render")
+    {
+        GlyphAtlas basic(std::make_shared<BasicPlaneFontInterface>(), "font", 20, TextQuality::BLENDED);
+        REQUIRE(basic.layout(u8"a\U0001f600b", layout));
+        REQUIRE(layout.text == u8"a\U0001f600b");
+        REQUIRE(quads.size() == 3);
+        REQUIRE(basic.getGlyphCount() == 4);
+
+        TextLayout fallback;
+        REQUIRE(basic.layout("?", fallback));
+        REQUIRE(quads[1].source == fallback.quads[0].source);
+
+        uint32_t renders = MockFontInterface::glyphRenderCount();
+        REQUIRE(basic.layout(u8"\U0001f600", layout));
+        REQUIRE(MockFontInterface::glyphRenderCount() == renders);
+    }
+
+    SECTION("unsupported interface")
+    {
+        GlyphAtlas unsupported(std::make_shared<UnsupportedFontInterface>(), "font", 20, TextQuality::SOLID);
+        REQUIRE(!unsupported.layout("a", layout));
+
+        REQUIRE(atlas.layout("ab", layout));
+        REQUIRE(!unsupported.layout("abc", layout));
+        REQUIRE(layout.text == "ab");
+        REQUIRE(quads.size() == 2);
+    }
+}
+
+TEST_CASE("GlyphRunTexture")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setFontInterface<MockFontInterface>()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .build<Game>();
+    auto builder = TextureBuilder::createTextBuilder().setGame(game).setName("score").setFontName("font");
+    builder.setFontSize(20).setText("0");
+
+    auto texture = std::dynamic_pointer_cast<GlyphRunTexture>(builder.build());
+    REQUIRE(texture != nullptr);
+    REQUIRE(texture->getQuads().size() == 1);
+
+    SECTION("atlases are shared")
+    {
+        auto other = std::dynamic_pointer_cast<GlyphRunTexture>(builder.setText("1").build());
+        REQUIRE(other->getAtlas() == texture->getAtlas());
+
+        builder.setFontSize(30);
+        REQUIRE(std::dynamic_pointer_cast<GlyphRunTexture>(builder.build())->getAtlas() != texture->getAtlas());
+    }
+
+    SECTION("update text in place")
+    {
+        uint32_t renders = MockFontInterface::glyphRenderCount();
+        REQUIRE(texture->setText("100"));
+        REQUIRE(texture->getText() == "100");
+        REQUIRE(texture->getQuads().size() == 3);
+        REQUIRE(texture->getTextSize().w == 36);
+        REQUIRE(MockFontInterface::glyphRenderCount() == renders + 1);
+    }
+
+    SECTION("disabled")
+    {
+        REQUIRE(std::dynamic_pointer_cast<GlyphRunTexture>(builder.setCached(false).build()) == nullptr);
+    }
+}
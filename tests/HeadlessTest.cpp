@@ -0,0 +1,113 @@
+#include "catch.hpp"
+
+#include <chrono>
+
+#include "core/builder/AnimationBuilder.h"
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "core/utils/AnimationUtils.h"
+#include "core/utils/ElementUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+
+#include "mocks/MockEventInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class CountingGame : public Game
+    {
+    public:
+        bool onLoop() override
+        {
+            ++loops;
+            totalDelta += getFrameDelta();
+            return false;
+        }
+
+        bool onRender() override
+        {
+            ++renders;
+            return false;
+        }
+
+        uint32_t loops = 0;
+        uint32_t renders = 0;
+        double totalDelta = 0;
+    };
+}
+
+
+TEST_CASE("Headless games")
+{
+    // would quit after 100000 frames, long after the frame limit
+    auto builder = GameBuilder::createBuilder()
+                       .setEventInterface<MockFramesEventInterface<100000>>()
+                       .setSettingsInterface<INISettingsInterface>()
+                       .setMaxFrames(600);
+
+    SECTION("run without delays and rendering")
+    {
+        auto game = builder.setHeadless(true).build<CountingGame>();
+        REQUIRE(game->isHeadless());
+
+        auto start = std::chrono::steady_clock::now();
+        game->run();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        // 600 frames at 60 FPS would take ten seconds
+        REQUIRE(elapsed < std::chrono::seconds(5));
+        REQUIRE(game->loops == 600);
+        REQUIRE(game->getFrameIndex() == 600);
+        REQUIRE(game->renders == 0);
+        REQUIRE(game->totalDelta == Approx(600 * 1000. / 60.).epsilon(0.01));
+    }
+
+    SECTION("render every n-th frame")
+    {
+        auto game = builder.setHeadless(true, 10).build<CountingGame>();
+        game->run();
+        REQUIRE(game->loops == 600);
+        REQUIRE(game->renders == 60);
+    }
+
+    SECTION("animations advance with every frame")
+    {
+        for (uint32_t renderInterval : {0, 1, 10}) {
+            auto game = builder.setHeadless(true, renderInterval).build<CountingGame>();
+            auto scene = SceneBuilder::createBuilder().setName("scene").setParentGame(game).build<Scene>();
+            auto element = ElementBuilder::createBuilder().setName("element").setParentScene(scene).build<Element>();
+
+            // one texture per frame, 600 frames end on texture 600 % 7
+            auto animation = AnimationBuilder::createBuilder()
+                                 .setName("animation")
+                                 .setFramesPerTexture(1)
+                                 .setParentElement(element)
+                                 .build<Animation>();
+            auto textureBuilder = TextureBuilder::createImageBuilder().setGame(game).setFilePath("missing.png");
+            for (int i = 0; i < 7; ++i) {
+                textureBuilder.setName("texture " + std::to_string(i)).setCached(false);
+                AnimationUtils::addTexture(animation, textureBuilder.build());
+            }
+            ElementUtils::activateAnimation(element, "animation");
+
+            game->run();
+            REQUIRE(animation->getCurrentFrame() == 5);
+        }
+    }
+
+    SECTION("null interfaces")
+    {
+        auto game = builder.setHeadless(true).setWindowSize({640, 480}).build<CountingGame>();
+        REQUIRE(game->getWindowSize() == Size(640, 480));
+
+        auto image = TextureBuilder::createImageBuilder().setGame(game).setName("image").setFilePath("missing.png");
+        REQUIRE(image.setCached(false).build() != nullptr);
+
+        auto text = TextureBuilder::createTextBuilder().setGame(game).setName("text").setText("headless");
+        REQUIRE(text.setFontName("font").setFontSize(12).build() != nullptr);
+    }
+}
@@ -0,0 +1,160 @@
+#include "catch.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/utils/ElementUtils.h"
+#include "core/utils/SceneUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "utils/SpatialGrid.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockEvents.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::vector<std::string> received;
+
+    class Widget : public Element
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            if (event.type != EventType::QUIT) {
+                received.push_back(getName());
+            }
+            return handles;
+        }
+
+        bool onLoop() override
+        {
+            renderBox.x += moveBy;
+            return false;
+        }
+
+        bool handles = false;
+        double moveBy = 0;
+    };
+}
+
+
+TEST_CASE("SpatialGrid")
+{
+    SpatialGrid grid(10);
+    grid.insert(0, {0, 0, 25, 5});
+    grid.insert(1, {-15, -15, 10, 10});
+    grid.insert(2, {20, 0, 0, 0});
+
+    std::vector<uint32_t> ids;
+    grid.query({22, 3}, ids);
+    REQUIRE(ids == std::vector<uint32_t>({0}));
+
+    ids.clear();
+    grid.query({-12, -8}, ids);
+    REQUIRE(ids == std::vector<uint32_t>({1}));
+
+    ids.clear();
+    grid.query({50, 50}, ids);
+    REQUIRE(ids.empty());
+
+    grid.clear();
+    grid.query({22, 3}, ids);
+    REQUIRE(ids.empty());
+}
+
+TEST_CASE("Hit testing")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockScriptedEventInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .setWindowSize({1000, 1000})
+                    .build<Game>();
+    auto scene =
+        SceneBuilder::createBuilder().setName("scene").setParentGame(game).setHitTesting(true).build<Scene>();
+
+    // relative render boxes, one percent is ten pixels
+    auto builder = ElementBuilder::createBuilder().setParentScene(scene);
+    auto background = builder.setName("background").setRenderBox({0, 0, 100, 100}).build<Widget>();
+    auto panel = builder.setName("panel").setRenderBox({10, 10, 50, 50}).build<Widget>();
+    auto button = builder.setName("button").setRenderBox({20, 20, 10, 10}).build<Widget>();
+
+    auto run = [&game](const std::vector<Event> &events) {
+        MockScriptedEventInterface::script() = {events};
+        received.clear();
+        game->run();
+        MockScriptedEventInterface::script().clear();
+        return received;
+    };
+    auto click = [&run](int32_t x, int32_t y) {
+        return run({createButtonEvent(Buttons::LEFT, ButtonState::DOWN, x, y)});
+    };
+
+    SECTION("top-most first with bubbling")
+    {
+        REQUIRE(click(250, 250) == std::vector<std::string>({"button", "panel", "background"}));
+        REQUIRE(click(500, 500) == std::vector<std::string>({"panel", "background"}));
+        REQUIRE(click(900, 900) == std::vector<std::string>({"background"}));
+
+        panel->handles = true;
+        REQUIRE(click(250, 250) == std::vector<std::string>({"button", "panel"}));
+    }
+
+    SECTION("other events are broadcast")
+    {
+        REQUIRE(run({createKeyEvent(Keys::A)}) == std::vector<std::string>({"background", "panel", "button"}));
+    }
+
+    SECTION("subscriptions")
+    {
+        ElementUtils::subscribe(panel, EventSubscription::forType(EventType::KEYBOARD));
+        REQUIRE(click(250, 250) == std::vector<std::string>({"button", "background"}));
+    }
+
+    SECTION("moving elements")
+    {
+        button->moveBy = 15;
+        REQUIRE(click(250, 250) == std::vector<std::string>({"button", "panel", "background"}));
+        REQUIRE(click(250, 250) == std::vector<std::string>({"panel", "background"}));
+        REQUIRE(click(850, 250) == std::vector<std::string>({"button", "background"}));
+    }
+
+    SECTION("boxes much larger than the window")
+    {
+        // a scrolling layer a hundred windows wide
+        auto layer = builder.setName("layer").setRenderBox({-5000, -5000, 10000, 10000}).build<Widget>();
+        REQUIRE(click(950, 50) == std::vector<std::string>({"layer", "background"}));
+
+        EventDispatcher dispatcher;
+        std::vector<std::shared_ptr<Element>> elements = {layer};
+        auto event = createButtonEvent(Buttons::LEFT, ButtonState::DOWN, 10, 990);
+        REQUIRE(dispatcher.getHitReceivers(event, elements, {1000, 1000}).size() == 1);
+
+        // the cells of the window only
+        size_t cells = static_cast<size_t>(std::ceil(1000 / dispatcher.getHitGrid().getCellSize()) + 1);
+        REQUIRE(dispatcher.getHitGrid().getCellCount() <= cells * cells);
+    }
+
+    SECTION("capture")
+    {
+        SceneUtils::capturePointer(scene, button);
+        REQUIRE(SceneUtils::getPointerCapture(scene) == button);
+        REQUIRE(click(900, 900) == std::vector<std::string>({"button"}));
+
+        SceneUtils::releasePointer(scene);
+        REQUIRE(click(900, 900) == std::vector<std::string>({"background"}));
+
+        SceneUtils::capturePointer(scene, button);
+        SceneUtils::removeElement(scene, "button");
+        REQUIRE(click(900, 900) == std::vector<std::string>({"background"}));
+        REQUIRE(SceneUtils::getPointerCapture(scene) == nullptr);
+    }
+}
@@ -0,0 +1,108 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "utils/ImageDiskCache.h"
+
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+TEST_CASE("ImageDiskCache")
+{
+    ImageDiskCache cache(".");
+
+    DecodedImage image;
+    image.width = 2;
+    image.height = 1;
+    image.pixels = {255, 128, 0, 255, 200, 100, 50, 0};
+
+    std::string text = "encoded image";
+    uint64_t hash = ImageDiskCache::hash(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+    cache.remove(hash);
+
+    SECTION("hash")
+    {
+        REQUIRE(ImageDiskCache::hash(nullptr, 0) == 14695981039346656037ull);
+        REQUIRE(hash != ImageDiskCache::hash(reinterpret_cast<const uint8_t *>(text.data()), text.size() - 1));
+    }
+
+    SECTION("premultiplied alpha")
+    {
+        image.pixels[3] = 128;
+        image.premultiplyAlpha();
+        REQUIRE(image.pixels == std::vector<uint8_t>({128, 64, 0, 128, 0, 0, 0, 0}));
+    }
+
+    SECTION("store and load")
+    {
+        DecodedImage loaded;
+        REQUIRE(!cache.load(hash, loaded));
+        REQUIRE(cache.store(hash, image));
+        REQUIRE(cache.load(hash, loaded));
+        REQUIRE(loaded.width == 2);
+        REQUIRE(loaded.height == 1);
+        REQUIRE(loaded.pixels == image.pixels);
+
+        image.pixels.pop_back();
+        REQUIRE(!cache.store(hash + 1, image));
+
+        std::ofstream(cache.getFilePath(hash), std::ios::binary) << "BKDI corrupt";
+        REQUIRE(!cache.load(hash, loaded));
+    }
+
+    SECTION("entries not matching their header are misses")
+    {
+        DecodedImage loaded;
+        std::string header("BKDI\x01\x00\x00\x00", 8);
+
+        // the size in the header is far beyond the file
+        std::ofstream(cache.getFilePath(hash), std::ios::binary) << header << std::string("\xff\xff\xff\x7f", 4)
+                                                                 << std::string("\xff\xff\xff\x7f", 4) << "pixels";
+        REQUIRE(!cache.load(hash, loaded));
+
+        // truncated by one byte
+        std::ofstream(cache.getFilePath(hash), std::ios::binary)
+            << header << std::string("\x02\x00\x00\x00\x01\x00\x00\x00", 8) << std::string(7, 'p');
+        REQUIRE(!cache.load(hash, loaded));
+
+        std::ofstream(cache.getFilePath(hash), std::ios::binary)
+            << header << std::string("\x02\x00\x00\x00\x01\x00\x00\x00", 8) << std::string(8, 'p');
+        REQUIRE(cache.load(hash, loaded));
+        REQUIRE(loaded.pixels.size() == 8);
+    }
+
+    SECTION("builders decode every image once")
+    {
+        std::string filePath = "disk_cache_image.png";
+        std::ofstream(filePath, std::ios::binary) << text;
+
+        auto game = GameBuilder::createBuilder()
+                        .setImageInterface<MockImageInterface>()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setImageCacheDirectory(".")
+                        .build<Game>();
+
+        uint32_t decodes = MockImageInterface::decodeCount();
+        uint32_t uploads = MockImageInterface::uploadCount();
+        auto builder = TextureBuilder::createImageBuilder().setGame(game).setName("image").setCached(false);
+        builder.setFilePath(filePath).build();
+        builder.setFilePath(filePath).build();
+        REQUIRE(MockImageInterface::decodeCount() == decodes + 1);
+        REQUIRE(MockImageInterface::uploadCount() == uploads + 2);
+
+        DecodedImage loaded;
+        REQUIRE(cache.load(hash, loaded));
+        REQUIRE(loaded.width == text.size());
+
+        std::remove(filePath.c_str());
+    }
+
+    cache.remove(hash);
+}
@@ -0,0 +1,127 @@
+#include "catch.hpp"
+
+#include <vector>
+
+#include "core/builder/GameBuilder.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "utils/InputState.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockEvents.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class PollingGame : public Game
+    {
+    public:
+        bool onLoop() override
+        {
+            auto &input = getInputState();
+            held.push_back(input.isDown(Keys::SPACE));
+            pressed.push_back(input.wasPressed(Keys::SPACE));
+            released.push_back(input.wasReleased(Keys::SPACE));
+            return false;
+        }
+
+        std::vector<bool> held;
+        std::vector<bool> pressed;
+        std::vector<bool> released;
+    };
+}
+
+
+TEST_CASE("InputState")
+{
+    InputState input;
+
+    SECTION("keys")
+    {
+        input.beginFrame();
+        input.update(createKeyEvent(Keys::W, KeyState::DOWN));
+        REQUIRE(input.isDown(Keys::W));
+        REQUIRE(input.wasPressed(Keys::W));
+        REQUIRE(!input.wasDown(Keys::W));
+        REQUIRE(!input.isDown(Keys::S));
+
+        input.beginFrame();
+        input.update(createKeyEvent(Keys::W, KeyState::DOWN, true));
+        REQUIRE(input.isDown(Keys::W));
+        REQUIRE(input.wasDown(Keys::W));
+        REQUIRE(!input.wasPressed(Keys::W));
+
+        input.beginFrame();
+        input.update(createKeyEvent(Keys::W, KeyState::UP));
+        REQUIRE(!input.isDown(Keys::W));
+        REQUIRE(input.wasReleased(Keys::W));
+    }
+
+    SECTION("press and release within one frame")
+    {
+        input.beginFrame();
+        input.update(createKeyEvent(Keys::E, KeyState::DOWN));
+        input.update(createKeyEvent(Keys::E, KeyState::UP));
+        REQUIRE(!input.isDown(Keys::E));
+        REQUIRE(input.wasPressed(Keys::E));
+        REQUIRE(input.wasReleased(Keys::E));
+    }
+
+    SECTION("mouse")
+    {
+        input.beginFrame();
+        input.update(createButtonEvent(Buttons::LEFT, ButtonState::DOWN, 10, 20));
+        input.update(createMotionEvent(15, 22, 5, 2));
+        input.update(createMotionEvent(18, 21, 3, -1));
+        REQUIRE(input.isDown(Buttons::LEFT));
+        REQUIRE(input.wasPressed(Buttons::LEFT));
+        REQUIRE(!input.isDown(Buttons::RIGHT));
+        REQUIRE(input.getMousePosition() == Point(18, 21));
+        REQUIRE(input.getMouseMotion() == Point(8, 1));
+
+        input.beginFrame();
+        REQUIRE(input.getMouseMotion() == Point(0, 0));
+        REQUIRE(input.wasDown(Buttons::LEFT));
+
+        input.reset();
+        REQUIRE(!input.isDown(Buttons::LEFT));
+        REQUIRE(input.wasReleased(Buttons::LEFT));
+    }
+
+    SECTION("focus loss releases everything held")
+    {
+        input.beginFrame();
+        input.update(createKeyEvent(Keys::A, KeyState::DOWN));
+        input.update(createButtonEvent(Buttons::RIGHT, ButtonState::DOWN, 0, 0));
+        input.update(createWindowEvent(WindowEventType::FOCUS_GAINED));
+        REQUIRE(input.isDown(Keys::A));
+
+        input.beginFrame();
+        input.update(createWindowEvent(WindowEventType::FOCUS_LOST));
+        REQUIRE(!input.isDown(Keys::A));
+        REQUIRE(input.wasReleased(Keys::A));
+        REQUIRE(!input.isDown(Buttons::RIGHT));
+        REQUIRE(input.wasReleased(Buttons::RIGHT));
+    }
+}
+
+TEST_CASE("Game updates the input state")
+{
+    MockScriptedEventInterface::script() = {{createKeyEvent(Keys::SPACE, KeyState::DOWN)},
+                                            {},
+                                            {createKeyEvent(Keys::SPACE, KeyState::UP)}};
+
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockScriptedEventInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .build<PollingGame>();
+    game->run();
+    MockScriptedEventInterface::script().clear();
+
+    REQUIRE(game->held == std::vector<bool>({true, true, false, false}));
+    REQUIRE(game->pressed == std::vector<bool>({true, false, false, false}));
+    REQUIRE(game->released == std::vector<bool>({false, false, true, false}));
+}
@@ -0,0 +1,165 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "utils/JobSystem.h"
+
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+TEST_CASE("JobSystem")
+{
+    for (uint32_t workerCount : {0u, 1u, 4u}) {
+        JobSystem jobSystem(workerCount);
+
+        SECTION("submit with counter (" + std::to_string(workerCount) + " workers)")
+        {
+            std::atomic<uint32_t> executed(0);
+            JobCounter counter;
+            for (int i = 0; i < 1000; ++i) {
+                jobSystem.submit([&executed]() { executed++; }, &counter);
+            }
+            jobSystem.wait(counter);
+            REQUIRE(counter.isDone());
+            REQUIRE(executed == 1000);
+        }
+
+        SECTION("nested jobs (" + std::to_string(workerCount) + " workers)")
+        {
+            std::atomic<uint32_t> executed(0);
+            JobCounter outer;
+            for (int i = 0; i < 16; ++i) {
+                jobSystem.submit(
+                    [&jobSystem, &executed]() {
+                        JobCounter inner;
+                        for (int j = 0; j < 16; ++j) {
+                            jobSystem.submit([&executed]() { executed++; }, &inner);
+                        }
+                        jobSystem.wait(inner);
+                    },
+                    &outer);
+            }
+            jobSystem.wait(outer);
+            REQUIRE(executed == 256);
+        }
+
+        SECTION("dependencies (" + std::to_string(workerCount) + " workers)")
+        {
+            std::atomic<uint32_t> first(0);
+            std::atomic<bool> orderViolated(false);
+            JobCounter firstCounter;
+            JobCounter secondCounter;
+            for (int i = 0; i < 100; ++i) {
+                jobSystem.submit([&first]() { first++; }, &firstCounter);
+            }
+            for (int i = 0; i < 10; ++i) {
+                jobSystem.submitAfter(firstCounter,
+                                      [&first, &orderViolated]() {
+                                          if (first != 100) {
+                                              orderViolated = true;
+                                          }
+                                      },
+                                      &secondCounter);
+            }
+            jobSystem.wait(secondCounter);
+            jobSystem.wait(firstCounter);
+            REQUIRE_FALSE(orderViolated);
+        }
+
+        SECTION("parallelFor (" + std::to_string(workerCount) + " workers)")
+        {
+            std::vector<uint32_t> values(10000, 0);
+            jobSystem.parallelFor(0, values.size(), 64, [&values](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    values[i] += i;
+                }
+            });
+            for (size_t i = 0; i < values.size(); ++i) {
+                REQUIRE(values[i] == i);
+            }
+
+            std::atomic<uint64_t> sum(0);
+            jobSystem.parallelFor(0, 1000, 0, [&sum](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    sum += i;
+                }
+            });
+            REQUIRE(sum == 999 * 1000 / 2);
+        }
+
+        SECTION("exceptions are rethrown by wait (" + std::to_string(workerCount) + " workers)")
+        {
+            JobCounter counter;
+            jobSystem.submit([]() { throw std::runtime_error("job failed"); }, &counter);
+            REQUIRE_THROWS_AS(jobSystem.wait(counter), std::runtime_error);
+            REQUIRE(counter.isDone());
+        }
+    }
+
+    SECTION("background jobs are left to the workers")
+    {
+        JobSystem jobSystem(1);
+        std::atomic<bool> loaded(false);
+        std::thread::id loadingThread;
+        jobSystem.submitBackground([&loaded, &loadingThread]() {
+            loadingThread = std::this_thread::get_id();
+            loaded = true;
+        });
+
+        for (int i = 0; i < 100; ++i) {
+            JobCounter counter;
+            jobSystem.submit([]() {}, &counter);
+            jobSystem.wait(counter);
+        }
+
+        while (!loaded) {
+            std::this_thread::yield();
+        }
+        REQUIRE(loadingThread != std::this_thread::get_id());
+
+        JobCounter counter;
+        jobSystem.submitBackground([]() {}, &counter);
+        jobSystem.wait(counter);
+        REQUIRE(counter.isDone());
+    }
+
+    SECTION("last reference dropped inside a job")
+    {
+        auto owner = std::make_shared<std::shared_ptr<JobSystem>>(std::make_shared<JobSystem>(2));
+        std::atomic<bool> destroyed(false);
+        (*owner)->submit([owner, &destroyed]() {
+            owner->reset();
+            destroyed = true;
+        });
+        owner.reset();
+
+        while (!destroyed) {
+            std::this_thread::yield();
+        }
+    }
+
+    SECTION("accessible from game, scene and element")
+    {
+        auto game =
+            GameBuilder::createBuilder().setGraphicsInterface<MockGraphicsInterface>().setWorkerCount(2).build<Game>();
+        auto scene = SceneBuilder::createBuilder().setName("scene").setParentGame(game).build<Scene>();
+        auto element = ElementBuilder::createBuilder().setName("element").setParentScene(scene).build<Element>();
+        auto orphan = ElementBuilder::createBuilder().setName("orphan").build<Element>();
+
+        REQUIRE(game->getJobSystem() != nullptr);
+        REQUIRE(game->getJobSystem()->getWorkerCount() == 2);
+        REQUIRE(scene->getJobSystem() == game->getJobSystem());
+        REQUIRE(element->getJobSystem() == game->getJobSystem());
+        REQUIRE(orphan->getJobSystem() == nullptr);
+    }
+}
@@ -0,0 +1,130 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/Logger.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::vector<std::string> splitLines(const std::string &text)
+    {
+        std::vector<std::string> lines;
+        std::istringstream stream(text);
+        std::string line;
+        while (std::getline(stream, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+}
+
+
+TEST_CASE("Logger")
+{
+    // messages other tests left unflushed must not end up in the output
+    std::ostringstream discarded;
+    Logger::SetOutput(discarded);
+    Logger::info << std::flush;
+    Logger::warning << std::flush;
+
+    std::ostringstream output;
+    Logger::SetOutput(output);
+    Logger::UseColors(false);
+
+    SECTION("messages are written when flushed")
+    {
+        Logger::info << "first " << 1;
+        REQUIRE(output.str().empty());
+        Logger::info << std::endl;
+        Logger::warning << "second" << std::endl;
+
+        auto lines = splitLines(output.str());
+        REQUIRE(lines.size() == 2);
+        REQUIRE(lines[0].find("[INFO] first 1") != std::string::npos);
+        REQUIRE(lines[1].find("[WARNING] second") != std::string::npos);
+    }
+
+    SECTION("async messages of several threads")
+    {
+        Logger::UseAsync(true);
+        REQUIRE(Logger::IsAsync());
+
+        const int threadCount = 4;
+        const int messageCount = 200;
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threadCount; ++thread) {
+            threads.emplace_back([thread]() {
+                for (int i = 0; i < messageCount; ++i) {
+                    Logger::info << "thread " << thread << " message " << i << std::endl;
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        std::string longMessage(1000, 'x');
+        Logger::warning << longMessage << std::endl;
+        Logger::Flush();
+        Logger::UseAsync(false);
+        REQUIRE(!Logger::IsAsync());
+
+        auto lines = splitLines(output.str());
+        REQUIRE(lines.size() == threadCount * messageCount + 1 - Logger::GetDroppedCount());
+        REQUIRE(Logger::GetDroppedCount() == 0);
+
+        std::vector<int> next(threadCount, 0);
+        bool ordered = true;
+        for (auto &line : lines) {
+            int thread, message;
+            auto position = line.find("[INFO] thread ");
+            if (position == std::string::npos) {
+                REQUIRE(line.find("[WARNING] " + longMessage) != std::string::npos);
+                continue;
+            }
+            std::istringstream(line.substr(position + 14)) >> thread;
+            message = std::stoi(line.substr(line.rfind(' ') + 1));
+            ordered = ordered && message == next[thread]++;
+        }
+        REQUIRE(ordered);
+    }
+
+    SECTION("stopping async mode while threads log")
+    {
+        const int threadCount = 4;
+        const int messageCount = 500;
+        std::atomic<int> started{0};
+        Logger::UseAsync(true);
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threadCount; ++thread) {
+            threads.emplace_back([&started]() {
+                ++started;
+                for (int i = 0; i < messageCount; ++i) {
+                    Logger::info << "message " << i << std::endl;
+                }
+            });
+        }
+        while (started < threadCount) {
+            std::this_thread::yield();
+        }
+        Logger::UseAsync(false);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        // every message is written asynchronously, synchronously or counted as dropped
+        auto lines = splitLines(output.str());
+        REQUIRE(lines.size() + Logger::GetDroppedCount() == threadCount * messageCount);
+    }
+
+    Logger::UseColors(true);
+    Logger::SetOutput(std::cout);
+}
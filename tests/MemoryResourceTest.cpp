@@ -0,0 +1,136 @@
+#include "catch.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "core/builder/AnimationBuilder.h"
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/utils/SceneUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "utils/MemoryResource.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class SpawningElement : public Element
+    {
+    public:
+        bool onLoop() override
+        {
+            auto scene = parent.lock();
+            if (SceneUtils::hasElement(scene, "bullet")) {
+                SceneUtils::removeElement(scene, "bullet");
+            }
+            bullet = ElementBuilder::createBuilder().setName("bullet").setParentScene(scene).build<Element>();
+            return false;
+        }
+
+        std::weak_ptr<Scene> parent;
+        std::shared_ptr<Element> bullet;
+    };
+}
+
+
+TEST_CASE("MemoryResource")
+{
+    SECTION("monotonic buffer hands out aligned memory from chunks")
+    {
+        MonotonicBufferResource arena(256);
+        REQUIRE(arena.getChunkCount() == 0);
+
+        void *first = arena.allocate(10, 1);
+        void *second = arena.allocate(16, 16);
+        REQUIRE(arena.getChunkCount() == 1);
+        REQUIRE(reinterpret_cast<uintptr_t>(second) % 16 == 0);
+        REQUIRE(static_cast<char *>(second) >= static_cast<char *>(first) + 10);
+
+        arena.deallocate(second, 16, 16);
+        REQUIRE(arena.getAllocatedBytes() == 26);
+
+        arena.allocate(1000);
+        REQUIRE(arena.getChunkCount() == 2);
+
+        arena.release();
+        REQUIRE(arena.getChunkCount() == 0);
+        REQUIRE(arena.getAllocatedBytes() == 0);
+    }
+
+    SECTION("containers use resource allocators")
+    {
+        auto arena = std::make_shared<MonotonicBufferResource>(1024);
+        std::vector<int, ResourceAllocator<int>> values{ResourceAllocator<int>(arena)};
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        REQUIRE(values[99] == 99);
+        REQUIRE(arena->getAllocatedBytes() >= 100 * sizeof(int));
+
+        REQUIRE(ResourceAllocator<int>(arena) == ResourceAllocator<double>(arena));
+        REQUIRE(ResourceAllocator<int>() != ResourceAllocator<int>(arena));
+    }
+
+    SECTION("scene objects are allocated from the scene arena")
+    {
+        auto scene = SceneBuilder::createBuilder().setName("level").setArenaSize(4096).build<Scene>();
+        auto arena = std::static_pointer_cast<MonotonicBufferResource>(scene->getMemoryResource());
+        REQUIRE(arena != nullptr);
+        REQUIRE(arena->getAllocatedBytes() == 0);
+
+        auto element = ElementBuilder::createBuilder().setName("player").setParentScene(scene).build<Element>();
+        size_t afterElement = arena->getAllocatedBytes();
+        REQUIRE(afterElement >= sizeof(Element));
+        REQUIRE(element->getMemoryResource() == arena);
+
+        AnimationBuilder::createBuilder().setName("idle").setParentElement(element).build<Animation>();
+        REQUIRE(arena->getAllocatedBytes() >= afterElement + sizeof(Animation));
+
+        std::weak_ptr<MemoryResource> weakArena = arena;
+        arena.reset();
+        scene.reset();
+        REQUIRE(!weakArena.expired());
+        REQUIRE(element->getName() == "player");
+
+        element.reset();
+        REQUIRE(weakArena.expired());
+    }
+
+    SECTION("objects spawned while the scene runs are not placed in the arena")
+    {
+        auto game = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setEventInterface<MockEventInterface>()
+                        .setSettingsInterface<INISettingsInterface>()
+                        .build<Game>();
+        auto scene =
+            SceneBuilder::createBuilder().setName("level").setParentGame(game).setArenaSize(4096).build<Scene>();
+        auto arena = std::static_pointer_cast<MonotonicBufferResource>(scene->getMemoryResource());
+        auto spawner =
+            ElementBuilder::createBuilder().setName("spawner").setParentScene(scene).build<SpawningElement>();
+        spawner->parent = scene;
+        size_t afterSetup = arena->getAllocatedBytes();
+
+        game->run();
+        game->run();
+
+        REQUIRE(spawner->bullet != nullptr);
+        REQUIRE(scene->getMemoryResource() == nullptr);
+        REQUIRE(spawner->bullet->getMemoryResource() == nullptr);
+        REQUIRE(arena->getAllocatedBytes() == afterSetup);
+    }
+
+    SECTION("scenes without arena keep using pools")
+    {
+        auto scene = SceneBuilder::createBuilder().setName("menu").build<Scene>();
+        REQUIRE(scene->getMemoryResource() == nullptr);
+
+        auto element = ElementBuilder::createBuilder().setName("button").setParentScene(scene).build<Element>();
+        REQUIRE(element->getMemoryResource() == nullptr);
+    }
+}
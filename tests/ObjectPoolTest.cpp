@@ -0,0 +1,102 @@
+#include "catch.hpp"
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "core/builder/ElementBuilder.h"
+#include "utils/ObjectPool.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    struct PooledObject
+    {
+        explicit PooledObject(int value) : value(value)
+        {
+        }
+
+        int value;
+        double padding[5];
+    };
+}
+
+
+TEST_CASE("ObjectPool")
+{
+    SECTION("blocks are recycled")
+    {
+        ObjectPool pool(sizeof(PooledObject), alignof(PooledObject), 4);
+        REQUIRE(pool.getCapacity() == 0);
+
+        void *first = pool.allocate();
+        REQUIRE(pool.getCapacity() == 4);
+        REQUIRE(pool.getFreeCount() == 3);
+
+        pool.deallocate(first);
+        REQUIRE(pool.getFreeCount() == 4);
+        REQUIRE(pool.allocate() == first);
+    }
+
+    SECTION("pool grows by chunks")
+    {
+        ObjectPool pool(24, 8, 4);
+        std::set<void *> blocks;
+        for (int i = 0; i < 9; ++i) {
+            blocks.insert(pool.allocate());
+        }
+        REQUIRE(blocks.size() == 9);
+        REQUIRE(pool.getCapacity() == 12);
+
+        for (void *block : blocks) {
+            REQUIRE(reinterpret_cast<uintptr_t>(block) % 8 == 0);
+            pool.deallocate(block);
+        }
+        REQUIRE(pool.getFreeCount() == 12);
+    }
+
+    SECTION("reserve")
+    {
+        ObjectPool pool(16, 8, 8);
+        pool.reserve(20);
+        REQUIRE(pool.getFreeCount() >= 20);
+        REQUIRE(pool.getCapacity() == 24);
+    }
+
+    SECTION("allocate_shared reuses freed slots")
+    {
+        PoolAllocator<PooledObject> allocator;
+        auto object = std::allocate_shared<PooledObject>(allocator, 42);
+        REQUIRE(object->value == 42);
+
+        const PooledObject *address = object.get();
+        object.reset();
+
+        auto recycled = std::allocate_shared<PooledObject>(allocator, 43);
+        REQUIRE(recycled.get() == address);
+        REQUIRE(recycled->value == 43);
+    }
+
+    SECTION("builders allocate from pools")
+    {
+        auto builder = ElementBuilder::createBuilder();
+        std::vector<std::shared_ptr<Element>> elements;
+        for (int i = 0; i < 100; ++i) {
+            elements.push_back(builder.setName("bullet " + std::to_string(i)).build<Element>());
+        }
+
+        std::set<const Element *> addresses;
+        for (auto &element : elements) {
+            addresses.insert(element.get());
+        }
+        elements.clear();
+
+        for (int i = 0; i < 100; ++i) {
+            auto element = builder.setName("bullet " + std::to_string(i)).build<Element>();
+            REQUIRE(addresses.count(element.get()) == 1);
+            elements.push_back(element);
+        }
+    }
+}
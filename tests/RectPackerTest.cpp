@@ -0,0 +1,70 @@
+#include "catch.hpp"
+
+#include <vector>
+
+#include "utils/RectPacker.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    bool overlap(const AbsRect &first, const AbsRect &second)
+    {
+        return first.x < second.x + second.w && second.x < first.x + first.w && first.y < second.y + second.h &&
+               second.y < first.y + first.h;
+    }
+}
+
+
+TEST_CASE("RectPacker")
+{
+    SECTION("rectangles do not overlap and stay inside")
+    {
+        RectPacker packer(256, 256, 2);
+        std::vector<AbsRect> placements;
+
+        for (uint32_t i = 0; i < 40; ++i) {
+            AbsRect placement;
+            uint32_t width = 8 + (i * 7) % 29;
+            uint32_t height = 8 + (i * 13) % 23;
+            REQUIRE(packer.insert(width, height, placement));
+            REQUIRE(placement.w == width);
+            REQUIRE(placement.h == height);
+            REQUIRE(placement.x + placement.w <= 256);
+            REQUIRE(placement.y + placement.h <= 256);
+
+            for (auto &other : placements) {
+                AbsRect padded(other.x, other.y, other.w + 2, other.h + 2);
+                REQUIRE(!overlap(padded, placement));
+            }
+            placements.push_back(placement);
+        }
+
+        REQUIRE(packer.getOccupancy() > 0);
+        REQUIRE(packer.getOccupancy() < 1);
+    }
+
+    SECTION("full area")
+    {
+        RectPacker packer(64, 64);
+        AbsRect placement;
+        for (int i = 0; i < 16; ++i) {
+            REQUIRE(packer.insert(16, 16, placement));
+        }
+        REQUIRE(packer.getOccupancy() == Approx(1));
+        REQUIRE(!packer.insert(1, 1, placement));
+
+        packer.reset();
+        REQUIRE(packer.insert(64, 64, placement));
+        REQUIRE(placement == AbsRect(0, 0, 64, 64));
+    }
+
+    SECTION("too large")
+    {
+        RectPacker packer(32, 32);
+        AbsRect placement;
+        REQUIRE(!packer.insert(33, 1, placement));
+        REQUIRE(!packer.insert(1, 33, placement));
+    }
+}
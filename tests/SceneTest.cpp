@@ -0,0 +1,180 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <set>
+#include <thread>
+
+#include "core/builder/ElementBuilder.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/SceneBuilder.h"
+#include "core/utils/GameUtils.h"
+#include "core/utils/SceneUtils.h"
+#include "interfaces/impl/INISettingsInterface.h"
+
+#include "mocks/MockEventInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class CountingElement : public Element
+    {
+    public:
+        bool onLoop() override
+        {
+            updates++;
+            threads.insert(std::this_thread::get_id());
+            return false;
+        }
+
+        std::atomic<uint32_t> updates{0};
+        std::set<std::thread::id> threads;
+    };
+
+    class SpawningElement : public Element
+    {
+    public:
+        bool onLoop() override
+        {
+            std::string spawnName = getName() + " child";
+            if (!SceneUtils::hasElement(parent, spawnName)) {
+                ElementBuilder::createBuilder().setName(spawnName).setParentScene(parent).build<Element>();
+            }
+            SceneUtils::moveElementToCollisionLayer(parent, getName(), 7);
+            return false;
+        }
+
+        std::shared_ptr<Scene> parent;
+    };
+
+    class MutatingElement : public Element
+    {
+    public:
+        bool onLoop() override
+        {
+            auto builder = ElementBuilder::createBuilder().setParentScene(parent);
+            builder.setName("temporary").build<Element>();
+            SceneUtils::removeElement(parent, "temporary");
+            auto spawned = builder.setName("spawned").setCollisionLayer(3).build<Element>();
+            SceneUtils::moveElementToCollisionLayer(parent, "spawned", 4);
+            SceneUtils::removeElement(parent, "victim");
+            SceneUtils::moveElementToCollisionLayer(parent, getName(), 2);
+
+            auto self = SceneUtils::getElement(parent, getName());
+            seenDuringUpdate =
+                SceneUtils::hasElement(parent, "spawned") && !SceneUtils::hasElement(parent, "victim")
+                && SceneUtils::getElementCount(parent) == 2
+                && SceneUtils::getElementNames(parent) == std::vector<std::string>({"mutating", "spawned"})
+                && SceneUtils::getCollisionLayer(parent, 0).empty()
+                && SceneUtils::getCollisionLayer(parent, 2) == std::vector<std::shared_ptr<Element>>({self})
+                && SceneUtils::getCollisionLayer(parent, 3).empty()
+                && SceneUtils::getCollisionLayer(parent, 4) == std::vector<std::shared_ptr<Element>>({spawned})
+                && SceneUtils::getCollisionLayerOfElement(parent, spawned).empty()
+                && spawned->getJobSystem() != nullptr;
+            return false;
+        }
+
+        bool onEvent(const Event &) override
+        {
+            SceneUtils::removeElement(parent, "event victim");
+            return false;
+        }
+
+        std::shared_ptr<Scene> parent;
+        bool seenDuringUpdate = false;
+    };
+}
+
+
+TEST_CASE("Scene")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .setEventInterface<MockEventInterface>()
+                    .setSettingsInterface<INISettingsInterface>()
+                    .setWorkerCount(4)
+                    .build<Game>();
+    auto sceneBuilder = SceneBuilder::createBuilder();
+    sceneBuilder.setName("test scene").setParentGame(game);
+
+    SECTION("serial update")
+    {
+        auto scene = sceneBuilder.build<Scene>();
+        auto element = ElementBuilder::createBuilder()
+                           .setName("element")
+                           .setThreadSafe(true)
+                           .setParentScene(scene)
+                           .build<CountingElement>();
+        game->run();
+        game->run();
+        REQUIRE(element->updates == 2);
+    }
+
+    SECTION("parallel update")
+    {
+        auto scene = sceneBuilder.setParallelUpdate(true).setUpdateGrainSize(8).build<Scene>();
+        std::vector<std::shared_ptr<CountingElement>> threadSafeElements;
+        std::vector<std::shared_ptr<CountingElement>> serialElements;
+        for (int i = 0; i < 256; ++i) {
+            auto builder = ElementBuilder::createBuilder().setParentScene(scene);
+            threadSafeElements.push_back(
+                builder.setName("thread safe " + std::to_string(i)).setThreadSafe(true).build<CountingElement>());
+            serialElements.push_back(
+                builder.setName("serial " + std::to_string(i)).setThreadSafe(false).build<CountingElement>());
+        }
+
+        game->run();
+
+        for (auto &element : threadSafeElements) {
+            REQUIRE(element->updates == 1);
+        }
+        for (auto &element : serialElements) {
+            REQUIRE(element->updates == 1);
+            REQUIRE(element->threads.count(std::this_thread::get_id()) == 1);
+        }
+    }
+
+    SECTION("structural changes during parallel update are deferred")
+    {
+        auto scene = sceneBuilder.setParallelUpdate(true).setUpdateGrainSize(1).build<Scene>();
+        for (int i = 0; i < 16; ++i) {
+            auto element = ElementBuilder::createBuilder()
+                               .setName("spawner " + std::to_string(i))
+                               .setThreadSafe(true)
+                               .setParentScene(scene)
+                               .build<SpawningElement>();
+            element->parent = scene;
+        }
+
+        REQUIRE(SceneUtils::getElementCount(scene) == 16);
+        game->run();
+        REQUIRE(SceneUtils::getElementCount(scene) == 32);
+        REQUIRE(SceneUtils::getCollisionLayer(scene, 7).size() == 16);
+        for (int i = 0; i < 16; ++i) {
+            REQUIRE(SceneUtils::hasElement(scene, "spawner " + std::to_string(i) + " child"));
+        }
+    }
+
+    SECTION("structural changes during serial update and event dispatch are deferred")
+    {
+        auto scene = sceneBuilder.build<Scene>();
+        auto builder = ElementBuilder::createBuilder().setParentScene(scene);
+        auto mutating = builder.setName("mutating").build<MutatingElement>();
+        mutating->parent = scene;
+        builder.setName("victim").build<Element>();
+        builder.setName("event victim").build<Element>();
+
+        game->run();
+
+        REQUIRE(mutating->seenDuringUpdate);
+        REQUIRE(SceneUtils::getElementNames(scene) == std::vector<std::string>({"mutating", "spawned"}));
+        REQUIRE(SceneUtils::getCollisionLayer(scene, 0).empty());
+        REQUIRE(SceneUtils::getCollisionLayer(scene, 2) == std::vector<std::shared_ptr<Element>>({mutating}));
+        REQUIRE(SceneUtils::getCollisionLayer(scene, 3).empty());
+        REQUIRE(SceneUtils::getCollisionLayer(scene, 4).size() == 1);
+        REQUIRE_FALSE(SceneUtils::hasElement(scene, "temporary"));
+        REQUIRE_THROWS_AS(SceneUtils::getElement(scene, "victim"), NameNotFoundException);
+    }
+}
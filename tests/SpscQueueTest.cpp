@@ -0,0 +1,151 @@
+#include "catch.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "core/builder/GameBuilder.h"
+#include "interfaces/impl/INISettingsInterface.h"
+#include "utils/SpscQueue.h"
+
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    /* Emits COUNT keyboard events followed by QUIT, only ever polled by a single thread. */
+    class CountingEventInterface : public EventInterface
+    {
+    public:
+        static const int COUNT = 1000;
+
+        bool ready() override
+        {
+            return emitted <= COUNT;
+        }
+
+        Event poll() override
+        {
+            Event event;
+            if (emitted < COUNT) {
+                event.type = EventType::KEYBOARD;
+                event.keyboard = {Keys::A, KeyState::DOWN, false};
+                event.timestamp = static_cast<uint64_t>(emitted + 1);
+            } else {
+                event.type = EventType::QUIT;
+            }
+            ++emitted;
+            return event;
+        }
+
+    private:
+        int emitted = 0;
+    };
+
+    const int CountingEventInterface::COUNT;
+
+    class RecordingGame : public Game
+    {
+    public:
+        bool onEvent(const Event &event) override
+        {
+            if (event.type == EventType::KEYBOARD) {
+                timestamps.push_back(event.timestamp);
+            }
+            return false;
+        }
+
+        std::vector<uint64_t> timestamps;
+    };
+}
+
+
+TEST_CASE("SpscQueue")
+{
+    SpscQueue<int> queue(4);
+    REQUIRE(queue.getCapacity() == 4);
+    REQUIRE(queue.empty());
+
+    SECTION("single values")
+    {
+        REQUIRE(queue.push(1));
+        REQUIRE(queue.push(2));
+        REQUIRE(queue.size() == 2);
+
+        int value = 0;
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == 1);
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == 2);
+        REQUIRE(!queue.pop(value));
+    }
+
+    SECTION("full queue rejects values")
+    {
+        int values[] = {1, 2, 3, 4, 5};
+        REQUIRE(queue.push(values, 5) == 4);
+        REQUIRE(!queue.push(6));
+        REQUIRE(queue.size() == 4);
+    }
+
+    SECTION("bulk operations wrap around")
+    {
+        int values[] = {1, 2, 3};
+        int result[4] = {0};
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(queue.push(values, 3) == 3);
+            REQUIRE(queue.pop(result, 4) == 3);
+            REQUIRE(result[0] == 1);
+            REQUIRE(result[2] == 3);
+        }
+        REQUIRE(queue.empty());
+    }
+
+    SECTION("values are transferred in order between threads")
+    {
+        const int count = 100000;
+        SpscQueue<int> transfer(64);
+        std::thread producer([&transfer]() {
+            for (int i = 0; i < count; ++i) {
+                while (!transfer.push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        bool ordered = true;
+        int expected = 0;
+        int buffer[16];
+        while (expected < count) {
+            size_t popped = transfer.pop(buffer, 16);
+            for (size_t i = 0; i < popped; ++i) {
+                ordered = ordered && buffer[i] == expected++;
+            }
+        }
+        producer.join();
+
+        REQUIRE(ordered);
+        REQUIRE(transfer.empty());
+    }
+}
+
+TEST_CASE("Game reads events queued by the input thread")
+{
+    auto builder = GameBuilder::createBuilder()
+                       .setGraphicsInterface<MockGraphicsInterface>()
+                       .setEventInterface<CountingEventInterface>()
+                       .setSettingsInterface<INISettingsInterface>();
+    REQUIRE_THROWS_AS(builder.setInputThread(true, 0), BuilderException);
+    REQUIRE_THROWS_AS(builder.setInputThread(true, 48), BuilderException);
+
+    auto game = builder.setInputThread(true, 64).build<RecordingGame>();
+    game->run();
+
+    REQUIRE(game->timestamps.size() == CountingEventInterface::COUNT);
+    bool ordered = true;
+    for (size_t i = 0; i < game->timestamps.size(); ++i) {
+        ordered = ordered && game->timestamps[i] == i + 1;
+    }
+    REQUIRE(ordered);
+}
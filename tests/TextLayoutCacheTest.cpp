@@ -0,0 +1,128 @@
+#include "catch.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/GlyphRunTexture.h"
+#include "core/TextLayoutCache.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+
+#include "mocks/MockFontInterface.h"
+#include "mocks/MockGraphicsInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    std::shared_ptr<const TextLayout> createLayout(const std::string &text)
+    {
+        auto layout = std::make_shared<TextLayout>();
+        layout->text = text;
+        return layout;
+    }
+
+    void requireSameLayout(const TextLayout &first, const TextLayout &second)
+    {
+        REQUIRE(first.text == second.text);
+        REQUIRE(first.quads.size() == second.quads.size());
+        for (size_t i = 0; i < first.quads.size(); ++i) {
+            REQUIRE(first.quads[i].source == second.quads[i].source);
+            REQUIRE(first.quads[i].destination == second.quads[i].destination);
+        }
+        REQUIRE(first.glyphs.size() == second.glyphs.size());
+        REQUIRE(first.bounds == second.bounds);
+    }
+}
+
+
+TEST_CASE("TextLayoutCache")
+{
+    TextLayoutCache cache(2);
+    auto atlas = std::make_shared<GlyphAtlas>(std::make_shared<MockFontInterface>(), "font", 12, TextQuality::SOLID);
+
+    SECTION("least recently used layouts are dropped")
+    {
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("a"));
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("b"));
+        REQUIRE(cache.get("a", "font", 12, TextQuality::SOLID, atlas) != nullptr);
+
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("c"));
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache.get("b", "font", 12, TextQuality::SOLID, atlas) == nullptr);
+        REQUIRE(cache.get("a", "font", 12, TextQuality::SOLID, atlas) != nullptr);
+        REQUIRE(cache.get("c", "font", 12, TextQuality::SOLID, atlas) != nullptr);
+
+        cache.setCapacity(1);
+        REQUIRE(cache.size() == 1);
+        REQUIRE(cache.get("c", "font", 12, TextQuality::SOLID, atlas) != nullptr);
+        REQUIRE(cache.getHitCount() == 4);
+        REQUIRE(cache.getMissCount() == 1);
+    }
+
+    SECTION("keys")
+    {
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("a"));
+        REQUIRE(cache.get("a", "font", 13, TextQuality::SOLID, atlas) == nullptr);
+        REQUIRE(cache.get("a", "other", 12, TextQuality::SOLID, atlas) == nullptr);
+        REQUIRE(cache.get("a", "font", 12, TextQuality::BLENDED, atlas) == nullptr);
+
+        cache.purge();
+        REQUIRE(cache.size() == 0);
+    }
+
+    SECTION("layouts of other atlases are dropped")
+    {
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("a"));
+        auto rebuilt = std::make_shared<GlyphAtlas>(std::make_shared<MockFontInterface>(), "font", 12,
+                                                    TextQuality::SOLID);
+        REQUIRE(cache.get("a", "font", 12, TextQuality::SOLID, rebuilt) == nullptr);
+        REQUIRE(cache.size() == 0);
+
+        cache.put("font", 12, TextQuality::SOLID, atlas, createLayout("b"));
+        atlas = nullptr;
+        REQUIRE(cache.get("b", "font", 12, TextQuality::SOLID, rebuilt) == nullptr);
+    }
+}
+
+TEST_CASE("Incremental text layout")
+{
+    GlyphAtlas atlas(std::make_shared<MockFontInterface>(), "font", 10, TextQuality::SOLID);
+    TextLayout incremental;
+
+    std::vector<std::string> texts = {"score: 10",
+                                      "score: 100",
+                                      "score: 99",
+                                      "",
+                                      u8"größe",
+                                      u8"grün",
+                                      "score: 99",
+                                      "score"};
+    for (auto &text : texts) {
+        TextLayout fresh;
+        REQUIRE(atlas.layout(text, fresh));
+        REQUIRE(atlas.layout(text, incremental));
+        requireSameLayout(incremental, fresh);
+    }
+}
+
+TEST_CASE("Text layouts are reused by builders")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setFontInterface<MockFontInterface>()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .build<Game>();
+    auto builder = TextureBuilder::createTextBuilder().setGame(game).setName("line").setFontName("font");
+    builder.setFontSize(10).setText("hello world");
+
+    auto first = std::dynamic_pointer_cast<GlyphRunTexture>(builder.build());
+    auto second = std::dynamic_pointer_cast<GlyphRunTexture>(builder.build());
+    REQUIRE(second->getQuads().size() == first->getQuads().size());
+    REQUIRE(second->getTextSize() == first->getTextSize());
+
+    second->setText("hello there");
+    REQUIRE(first->getText() == "hello world");
+    REQUIRE(second->getQuads().size() == first->getQuads().size());
+}
@@ -0,0 +1,69 @@
+#include "catch.hpp"
+
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureAtlasBuilder.h"
+#include "core/builder/TextureBuilder.h"
+
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+TEST_CASE("TextureAtlasBuilder")
+{
+    SECTION("offline layout")
+    {
+        auto builder = TextureAtlasBuilder::createBuilder().setPageSize({64, 64}).setPadding(0);
+        for (int i = 0; i < 5; ++i) {
+            builder.addImage("tile " + std::to_string(i), "tiles.png", {i * 32., 0, 32, 32});
+        }
+
+        auto regions = builder.buildLayout();
+        REQUIRE(regions.size() == 5);
+        REQUIRE(regions[0].name == "tile 0");
+        REQUIRE(regions[4].page == 1);
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(regions[i].page == 0);
+        }
+    }
+
+    SECTION("invalid images")
+    {
+        auto builder = TextureAtlasBuilder::createBuilder().setPageSize({64, 64});
+        builder.addImage("tile", "tiles.png");
+        REQUIRE_THROWS_AS(builder.addImage("tile", "other.png"), NameAlreadyExistsException);
+        REQUIRE_THROWS_AS(builder.buildLayout(), BuilderException);
+
+        auto tooLarge = TextureAtlasBuilder::createBuilder().setPageSize({64, 64});
+        tooLarge.addImage("background", "background.png", {0, 0, 128, 16});
+        REQUIRE_THROWS_AS(tooLarge.buildLayout(), BuilderException);
+    }
+
+    SECTION("atlas textures")
+    {
+        auto game = GameBuilder::createBuilder()
+                        .setGraphicsInterface<MockGraphicsInterface>()
+                        .setImageInterface<MockImageInterface>()
+                        .build<Game>();
+
+        auto builder = TextureAtlasBuilder::createBuilder().setGame(game).setPageSize({128, 128});
+        builder.addImage("player", "player.png").addImage("enemy", "enemy.png");
+        auto atlas = builder.build();
+
+        REQUIRE(atlas->getPageCount() == 1);
+        REQUIRE(atlas->getRegion("enemy").source == AbsRect(0, 0, 64, 32));
+        REQUIRE_THROWS_AS(atlas->getRegion("boss"), NameNotFoundException);
+
+        auto textureBuilder = TextureBuilder::createImageBuilder().setGame(game);
+        auto player = std::static_pointer_cast<ImageTexture>(
+            textureBuilder.setName("player").setAtlasRegion(atlas, "player").build());
+        auto enemy = std::static_pointer_cast<ImageTexture>(
+            textureBuilder.setName("enemy").setAtlasRegion(atlas, "enemy").build());
+
+        REQUIRE(player->getPage() == atlas->getPage(0));
+        REQUIRE(enemy->getPage() == player->getPage());
+        REQUIRE(player->getClip() == atlas->getRegion("player").destination);
+        REQUIRE(player->getClip() != enemy->getClip());
+    }
+}
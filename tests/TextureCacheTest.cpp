@@ -0,0 +1,123 @@
+#include "catch.hpp"
+
+#include "core/TextureCache.h"
+#include "core/builder/GameBuilder.h"
+#include "core/builder/TextureBuilder.h"
+#include "exceptions/BuilderException.h"
+
+#include "mocks/MockGraphicsInterface.h"
+#include "mocks/MockImageInterface.h"
+
+using namespace bkengine;
+
+
+namespace
+{
+    class UniqueImageTexture : public ImageTexture
+    {
+    public:
+        void onRender() override
+        {
+        }
+    };
+
+    class UniqueImageInterface : public ImageInterface
+    {
+    public:
+        std::shared_ptr<ImageTexture> renderImageFileToTexture(const std::string &, const AbsRect &) override
+        {
+            return std::make_shared<UniqueImageTexture>();
+        }
+    };
+
+    class FailingImageInterface : public ImageInterface
+    {
+    public:
+        std::shared_ptr<ImageTexture> renderImageFileToTexture(const std::string &, const AbsRect &) override
+        {
+            return nullptr;
+        }
+    };
+}
+
+
+TEST_CASE("TextureCache")
+{
+    auto game = GameBuilder::createBuilder()
+                    .setImageInterface<MockImageInterface>()
+                    .setGraphicsInterface<MockGraphicsInterface>()
+                    .build<Game>();
+    auto builder = TextureBuilder::createImageBuilder().setGame(game).setFilePath("tiles.png");
+    uint32_t renders = MockImageInterface::renderCount();
+
+    SECTION("same file and clip share pixel data")
+    {
+        auto first = std::static_pointer_cast<ImageTexture>(
+            builder.setName("first").setClip({0, 0, 16, 16}).setTexturePosition({1, 2}).build());
+        auto second = std::static_pointer_cast<ImageTexture>(
+            builder.setName("second").setClip({0, 0, 16, 16}).setTexturePosition({3, 4}).build());
+
+        REQUIRE(MockImageInterface::renderCount() == renders + 1);
+        REQUIRE(first != second);
+        REQUIRE(first->getPage() != nullptr);
+        REQUIRE(first->getPage() == second->getPage());
+        REQUIRE(first->getName() == "first");
+        REQUIRE(second->getName() == "second");
+
+        auto other = builder.setName("other").setClip({16, 0, 16, 16}).build();
+        REQUIRE(MockImageInterface::renderCount() == renders + 2);
+    }
+
+    SECTION("shared data is released with its last texture")
+    {
+        auto texture = builder.setName("texture").build();
+        texture.reset();
+
+        builder.setName("texture").build();
+        REQUIRE(MockImageInterface::renderCount() == renders + 2);
+    }
+
+    SECTION("caching can be disabled")
+    {
+        auto first = builder.setName("first").setCached(false).build();
+        auto second = builder.setName("second").setCached(false).build();
+        REQUIRE(MockImageInterface::renderCount() == renders + 2);
+    }
+
+    SECTION("textures without clone support are not cached")
+    {
+        TextureCache cache;
+        UniqueImageInterface imageInterface;
+        auto first = cache.getImageTexture(imageInterface, "tiles.png", {0, 0, 16, 16});
+        auto second = cache.getImageTexture(imageInterface, "tiles.png", {0, 0, 16, 16});
+
+        REQUIRE(first != second);
+        REQUIRE(first->getPage() == nullptr);
+        REQUIRE(cache.size() == 0);
+    }
+
+    SECTION("failed renders throw")
+    {
+        TextureCache cache;
+        FailingImageInterface imageInterface;
+        REQUIRE_THROWS_AS(cache.getImageTexture(imageInterface, "missing.png", {0, 0, 16, 16}), BuilderException);
+        REQUIRE(cache.size() == 0);
+        REQUIRE(cache.getMissCount() == 0);
+    }
+
+    SECTION("hit and miss counts")
+    {
+        TextureCache cache;
+        MockImageInterface imageInterface;
+        auto first = cache.getImageTexture(imageInterface, "tiles.png", {0, 0, 16, 16});
+        auto second = cache.getImageTexture(imageInterface, "tiles.png", {0, 0, 16, 16});
+
+        REQUIRE(cache.getMissCount() == 1);
+        REQUIRE(cache.getHitCount() == 1);
+        REQUIRE(cache.size() == 1);
+
+        first.reset();
+        second.reset();
+        REQUIRE(cache.size() == 0);
+    }
+}
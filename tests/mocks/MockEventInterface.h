@@ -0,0 +1,93 @@
+#ifndef BKENGINE_TESTS_MOCK_EVENT_INTERFACE_H
+#define BKENGINE_TESTS_MOCK_EVENT_INTERFACE_H
+
+#include <vector>
+
+#include "interfaces/EventInterface.h"
+
+
+/* Emits a single QUIT event in the last of Frames frames, so every run() executes exactly Frames frames. */
+template <uint32_t Frames>
+class MockFramesEventInterface : public bkengine::EventInterface
+{
+public:
+    bool ready() override
+    {
+        if (pending) {
+            pending = false;
+            return false;
+        }
+
+        if (--framesLeft > 0) {
+            return false;
+        }
+
+        framesLeft = Frames;
+        pending = true;
+        return true;
+    }
+
+    bkengine::Event poll() override
+    {
+        bkengine::Event event;
+        event.type = bkengine::EventType::QUIT;
+        return event;
+    }
+
+private:
+    bool pending = false;
+    uint32_t framesLeft = Frames;
+};
+
+typedef MockFramesEventInterface<1> MockEventInterface;
+
+/* Emits the events of script()[i] in frame i and QUIT in the frame after the last scripted one. */
+class MockScriptedEventInterface : public bkengine::EventInterface
+{
+public:
+    static std::vector<std::vector<bkengine::Event>> &script()
+    {
+        static std::vector<std::vector<bkengine::Event>> frames;
+        return frames;
+    }
+
+    bool ready() override
+    {
+        auto &frames = script();
+        if (frame < frames.size()) {
+            if (index < frames[frame].size()) {
+                return true;
+            }
+            ++frame;
+            index = 0;
+            return false;
+        }
+
+        if (!quit) {
+            quit = true;
+            return true;
+        }
+        quit = false;
+        frame = 0;
+        return false;
+    }
+
+    bkengine::Event poll() override
+    {
+        auto &frames = script();
+        if (frame < frames.size()) {
+            return frames[frame][index++];
+        }
+
+        bkengine::Event event;
+        event.type = bkengine::EventType::QUIT;
+        return event;
+    }
+
+private:
+    size_t frame = 0;
+    size_t index = 0;
+    bool quit = false;
+};
+
+#endif  // BKENGINE_TESTS_MOCK_EVENT_INTERFACE_H
@@ -0,0 +1,55 @@
+#ifndef BKENGINE_TESTS_MOCK_EVENTS_H
+#define BKENGINE_TESTS_MOCK_EVENTS_H
+
+#include <cstdint>
+
+#include "utils/Event.h"
+
+
+/* Factories for the events tests feed into games, interfaces and input utilities. */
+namespace bkengine
+{
+    inline Event createKeyEvent(const Key &key, KeyState state = KeyState::DOWN, bool repeat = false)
+    {
+        Event event;
+        event.type = EventType::KEYBOARD;
+        event.keyboard = {key, state, repeat};
+        return event;
+    }
+
+    inline Event createButtonEvent(const Button &button, ButtonState state, int32_t x, int32_t y)
+    {
+        Event event;
+        event.type = EventType::MOUSE;
+        event.mouse = {state, button, 0, 1, x, y};
+        return event;
+    }
+
+    inline Event createMotionEvent(int32_t x, int32_t y, int32_t relativeX = 0, int32_t relativeY = 0,
+                                   uint64_t timestamp = 0)
+    {
+        Event event;
+        event.type = EventType::MOTION;
+        event.timestamp = timestamp;
+        event.motion = {x, y, relativeX, relativeY};
+        return event;
+    }
+
+    inline Event createWheelEvent(int32_t x = 0, int32_t y = 1, WheelDirection direction = WheelDirection::NORMAL)
+    {
+        Event event;
+        event.type = EventType::WHEEL;
+        event.wheel = {x, y, direction};
+        return event;
+    }
+
+    inline Event createWindowEvent(WindowEventType type, int32_t data1 = 0, int32_t data2 = 0)
+    {
+        Event event;
+        event.type = EventType::WINDOW;
+        event.window = {type, data1, data2};
+        return event;
+    }
+}
+
+#endif
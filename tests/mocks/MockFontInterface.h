@@ -1,10 +1,13 @@
 #ifndef BKENGINE_MOCK_FONT_INTERFACE_H
 #define BKENGINE_MOCK_FONT_INTERFACE_H
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "interfaces/FontInterface.h"
+#include "utils/ObjectPool.h"
 
 
 namespace bkengine
@@ -16,19 +19,90 @@ namespace bkengine
         {
         }
     };
+
+    class MockGlyphRunTexture : public GlyphRunTexture
+    {
+    public:
+        void onRender() override
+        {
+        }
+    };
+
+    class MockGlyphPage : public ImageTexture
+    {
+    public:
+        void onRender() override
+        {
+        }
+
+        TextQuality quality = TextQuality::SOLID;
+        std::vector<GlyphBitmap> glyphs;
+    };
+
     class MockFontInterface : public FontInterface
     {
     public:
+        static std::atomic<uint32_t> &glyphRenderCount()
+        {
+            static std::atomic<uint32_t> count{0};
+            return count;
+        }
+
+        static TextQuality &lastRenderQuality()
+        {
+            static TextQuality quality = TextQuality::SOLID;
+            return quality;
+        }
+
         void registerFont(const std::string &filePath, const std::string &fontName, double size) override
         {
         }
 
-        std::shared_ptr<TextTexture>
-        renderFontToTexture(const std::string &text, const std::string &fontName, double size, TextQuality) override
+        std::shared_ptr<TextTexture> renderFontToTexture(const std::string &text,
+                                                         const std::string &fontName,
+                                                         double size,
+                                                         TextQuality quality) override
+        {
+            lastRenderQuality() = quality;
+            return std::allocate_shared<MockFontTexture>(PoolAllocator<MockFontTexture>());
+        }
+
+        // glyphs are boxes of half the font size wide, spaces are empty
+        bool renderGlyph(const std::string &fontName,
+                         double size,
+                         TextQuality,
+                         uint32_t codepoint,
+                         GlyphBitmap &glyph) override
+        {
+            glyphRenderCount()++;
+            glyph.width = codepoint == ' ' ? 0 : static_cast<uint32_t>(size / 2);
+            glyph.height = codepoint == ' ' ? 0 : static_cast<uint32_t>(size);
+            glyph.offsetX = 1;
+            glyph.offsetY = 0;
+            glyph.advance = static_cast<int32_t>(size / 2) + 2;
+            glyph.pixels.assign(glyph.width * glyph.height, 255);
+            return true;
+        }
+
+        std::shared_ptr<ImageTexture> createGlyphPage(const Size &, TextQuality quality) override
+        {
+            auto page = std::allocate_shared<MockGlyphPage>(PoolAllocator<MockGlyphPage>());
+            page->quality = quality;
+            return page;
+        }
+
+        void updateGlyphPage(const std::shared_ptr<ImageTexture> &page,
+                             const AbsRect &,
+                             const GlyphBitmap &glyph) override
+        {
+            std::static_pointer_cast<MockGlyphPage>(page)->glyphs.push_back(glyph);
+        }
+
+        std::shared_ptr<GlyphRunTexture> createGlyphRunTexture() override
         {
-            return std::make_shared<MockFontTexture>();
+            return std::allocate_shared<MockGlyphRunTexture>(PoolAllocator<MockGlyphRunTexture>());
         }
     };
 }
 
-#endif  // BKENGINE_MOCK_FONT_INTERFACE_H
\ No newline at end of file
+#endif  // BKENGINE_MOCK_FONT_INTERFACE_H
@@ -1,10 +1,12 @@
 #ifndef BKENGINE_MOCK_IMAGE_INTERFACE_H
 #define BKENGINE_MOCK_IMAGE_INTERFACE_H
 
+#include <atomic>
 #include <memory>
 #include <string>
 
 #include "interfaces/ImageInterface.h"
+#include "utils/ObjectPool.h"
 
 
 namespace bkengine
@@ -15,14 +17,85 @@ namespace bkengine
         void onRender() override
         {
         }
+
+        std::shared_ptr<ImageTexture> clone() const override
+        {
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>(), *this);
+        }
     };
 
     class MockImageInterface : public ImageInterface
     {
     public:
+        static uint32_t &renderCount()
+        {
+            static uint32_t count = 0;
+            return count;
+        }
+
+        static uint32_t &dataRenderCount()
+        {
+            static uint32_t count = 0;
+            return count;
+        }
+
+        static std::atomic<uint32_t> &decodeCount()
+        {
+            static std::atomic<uint32_t> count{0};
+            return count;
+        }
+
+        static uint32_t &uploadCount()
+        {
+            static uint32_t count = 0;
+            return count;
+        }
+
         std::shared_ptr<ImageTexture> renderImageFileToTexture(const std::string &, const AbsRect &) override
         {
-            return std::make_shared<MockImageTexture>();
+            renderCount()++;
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>());
+        }
+
+        std::shared_ptr<ImageTexture> renderImageDataToTexture(const AssetData &, const AbsRect &) override
+        {
+            dataRenderCount()++;
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>());
+        }
+
+        // every encoded byte becomes an opaque gray pixel of a one pixel high image
+        bool decodeImage(const AssetData &data, DecodedImage &image) override
+        {
+            decodeCount()++;
+            image.width = data.size;
+            image.height = 1;
+            image.pixels.clear();
+            for (size_t i = 0; i < data.size; ++i) {
+                image.pixels.insert(image.pixels.end(), {data.data[i], data.data[i], data.data[i], 255});
+            }
+            return true;
+        }
+
+        std::shared_ptr<ImageTexture> uploadImage(const DecodedImage &, const AbsRect &) override
+        {
+            uploadCount()++;
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>());
+        }
+
+        Size getImageSize(const std::string &) override
+        {
+            return {64, 32};
+        }
+
+        std::shared_ptr<ImageTexture> renderAtlasPage(const Size &, const std::vector<AtlasRegion> &) override
+        {
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>());
+        }
+
+        std::shared_ptr<ImageTexture> createPageTexture(const std::shared_ptr<ImageTexture> &,
+                                                        const AbsRect &) override
+        {
+            return std::allocate_shared<MockImageTexture>(PoolAllocator<MockImageTexture>());
         }
     };
 }
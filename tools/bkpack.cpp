@@ -0,0 +1,50 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "utils/AssetArchive.h"
+
+using namespace bkengine;
+
+
+/*
+    Packs asset files into an archive which can be mounted with GameUtils::mountArchive.
+    Entries are named by the paths given on the command line, which are the paths the
+    texture builders and GameUtils::registerFont are called with.
+
+    usage: bkpack [-c] <archive> <file>...
+        -c  compress the entries with LZ4 (entries which do not shrink are stored as is)
+*/
+int main(int argc, char **argv)
+{
+    bool compress = false;
+    std::vector<std::string> arguments;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-c") == 0) {
+            compress = true;
+        } else {
+            arguments.push_back(argv[i]);
+        }
+    }
+
+    if (arguments.size() < 2) {
+        std::cerr << "usage: " << argv[0] << " [-c] <archive> <file>..." << std::endl;
+        return 1;
+    }
+
+    try {
+        AssetArchiveWriter writer;
+        for (size_t i = 1; i < arguments.size(); ++i) {
+            writer.addFile(arguments[i], arguments[i], compress);
+        }
+        writer.write(arguments[0]);
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "packed " << arguments.size() - 1 << " files into " << arguments[0] << std::endl;
+    return 0;
+}